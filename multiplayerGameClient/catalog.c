@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include "catalog.h"
+
+#define COLOR_RED "\x1b[1;31m"
+#define COLOR_YELLOW "\x1b[1;33m"
+#define COLOR_MAGENTA "\x1b[1;35m"
+#define COLOR_DEFAULT "\x1b[1;0m"
+
+static const char* zoneNames[] = {"CARAVAN", "KITCHEN", "LIVING_ROOM", "ROOM", "BATHROOM", "GARAGE", "BASEMENT", "-"};
+static const char* objectNames[] = {"-", "EMF", "SPIRIT_BOX", "CAMERA", "SEDATIVE", "SALT", "ADRENALINE", "HUNDRED_DOLLAR", "KNIFE", "TRANQUILLIZER", "NO_OBJECT", "EMF_EVIDENCE", "SPIRIT_BOX_EVIDENCE", "CAMERA_EVIDENCE", "NO_EVIDENCE", "EMPTY_SLOT"};
+
+// The texts use only %d and %s as placeholders, and %% to show the %
+static const char* catalogTexts[CATALOG_SIZE] = {
+    [MSG_ACTION_MENU] = "\n1) Go to the caravan to deposit all the evidence from the backpack;\n2) Go to the next zone;\n3) Pick the evidence from the current zone;\n4) Pick the object from the current zone;\n5) Use an object from the backpack;\n6) Skip the turn;\n7) Give an object to another player in the same room;\n8) Remove an object;\n9) Reorganize the backpack;\n10) Print the player info;\n11) Print the current zone info;\n12) Print all the evidence in the caravan;\n13) Print the ghost info;\n14) Print the game info;\n15) Exit the game.\nChoose an action from the option above: ",
+    [MSG_USE_MENU] = "\n5) Print all the effects of the objects availables;\n6) Exit the menu.\nChoose from the option above: ",
+    [MSG_BUY_MENU] = "\nChoose what you want to buy between: \n1) TRANQUILLIZER;\n2) SALT.\nInsert an option: ",
+    [MSG_EXIT_MENU] = "\n5) Exit the menu.\nChoose from the option above: ",
+    [MSG_SWAP_MENU] = "\n5) Exit the menu.\nInsert the number of the slot to swap: ",
+    [MSG_TURN_BANNER] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n" COLOR_DEFAULT,
+    [MSG_WAIT_TURN_END] = COLOR_YELLOW "\nWait the end of the current turn!" COLOR_DEFAULT,
+    [MSG_PRESS_ENTER] = "\n" COLOR_YELLOW "Press ENTER to continue: " COLOR_DEFAULT,
+    [MSG_EVIDENCE_LEFT] = COLOR_MAGENTA "\nEvidence (%s) has been left in the caravan!" COLOR_DEFAULT,
+    [MSG_NO_EVIDENCES] = COLOR_YELLOW "\nYou don't have evidences!" COLOR_DEFAULT,
+    [MSG_REPOSITIONED_FIRST_ZONE] = COLOR_MAGENTA "\nYou have been repositioned in the first zone!" COLOR_DEFAULT,
+    [MSG_PLAYER_INFO_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- PLAYER INFO -------------\n" COLOR_DEFAULT "\nGhost position: %s\nGhost appeareance probability: %d%%\nName: %s\nMental Health: %d\nPosition: %s%s%s",
+    [MSG_BACKPACK_SLOT] = "\nSlot %d: %s",
+    [MSG_ZONE_INFO_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- ZONE INFO -------------\n" COLOR_DEFAULT "\nCurrent zone: %s\nEvidence in the current zone: %s\nObject in the current zone: %s\nNext zone: %s",
+    [MSG_OBJECT_ADDED] = COLOR_MAGENTA "\nThe object in the %s has been added!" COLOR_DEFAULT,
+    [MSG_REPOSITIONED] = COLOR_MAGENTA "\nYou have been repositioned in the %s!" COLOR_DEFAULT,
+    [MSG_EVIDENCE_CHANGED] = COLOR_MAGENTA "\nThe evidence in the %s has been changed!" COLOR_DEFAULT,
+    [MSG_NO_PICKABLE_OBJECT] = COLOR_YELLOW "\nThere's no object in this zone that can be picked!" COLOR_DEFAULT,
+    [MSG_EVIDENCE_PICKED] = COLOR_MAGENTA "\nEvidence %s has been picked!" COLOR_DEFAULT,
+    [MSG_GHOST_SPAWNED] = COLOR_MAGENTA "\nThe ghost spawn in the %s zone!" COLOR_DEFAULT,
+    [MSG_GHOST_ATTACK] = COLOR_MAGENTA "\nThe ghost is in the same room as %s, so %s's mental health decrease to %d!" COLOR_DEFAULT,
+    [MSG_GHOST_PROBABILITY_INCREASED] = COLOR_MAGENTA "\nThe probabilities that the ghost appears have been increased to %d%% " COLOR_DEFAULT,
+    [MSG_MISSING_EVIDENCE_OBJECT] = COLOR_YELLOW "\nYou don't have the object to pick the evidence in this zone!" COLOR_DEFAULT,
+    [MSG_NO_ZONE_OBJECTS] = COLOR_YELLOW "\nThe current zone has no objects!" COLOR_DEFAULT,
+    [MSG_OBJECT_PICKED] = COLOR_MAGENTA "\nYou have picked the %s!" COLOR_DEFAULT,
+    [MSG_BACKPACK_FULL] = COLOR_YELLOW "\nThe backpack's slots are full, you can't pick the object!" COLOR_DEFAULT,
+    [MSG_USABLE_OBJECTS_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- USABLE OBJECTS -------------\n" COLOR_DEFAULT,
+    [MSG_USE_OPTION] = "\n%d) Use the %s;",
+    [MSG_NO_USABLE_OBJECTS] = COLOR_YELLOW "\nThere aren't object that can be used!" COLOR_DEFAULT,
+    [MSG_INVALID_INPUT] = COLOR_RED "\nError: please insert a valid input!" COLOR_DEFAULT,
+    [MSG_OBJECTS_INFO_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- OBJECTS INFO -------------\n" COLOR_DEFAULT "%s",
+    [MSG_PRESS_ENTER_SPACED] = "\n\n" COLOR_YELLOW "Press ENTER to continue: " COLOR_DEFAULT,
+    [MSG_SEDATIVE_USED] = COLOR_MAGENTA "\nYou used the SEDATIVE, and your mental health has increased to %d!" COLOR_DEFAULT,
+    [MSG_SALT_USED] = COLOR_MAGENTA "\nYou used the SALT, the next appearence of the ghost won't affect your mental health!" COLOR_DEFAULT,
+    [MSG_ADRENALINE_USED] = COLOR_MAGENTA "\nYou used the ADRENALINE, and went to the next zone, obtaining an extra turn!" COLOR_DEFAULT,
+    [MSG_TRANQUILLIZER_BOUGHT] = COLOR_MAGENTA "\nYou bought the TRANQUILLIZER!" COLOR_DEFAULT,
+    [MSG_SALT_BOUGHT] = COLOR_MAGENTA "\nYou bought the SALT!" COLOR_DEFAULT,
+    [MSG_KNIFE_KILLED] = COLOR_MAGENTA "\nYou used the KNIFE, and killed %s!" COLOR_DEFAULT,
+    [MSG_KNIFE_MISSED] = COLOR_MAGENTA "\nYou used the KNIFE, but you didn't hurt anybody!" COLOR_DEFAULT,
+    [MSG_TRANQUILLIZER_USED] = COLOR_MAGENTA "\nYou used the TRANQUILLIZER, and your mental health has increased to %d!" COLOR_DEFAULT,
+    [MSG_SELF_TRADE] = COLOR_YELLOW "\nYou can't trade with yourself!" COLOR_DEFAULT,
+    [MSG_GIVABLE_OBJECTS_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- GIVABLE OBJECTS -------------\n" COLOR_DEFAULT,
+    [MSG_GIVE_OPTION] = "\n%d) Give the %s",
+    [MSG_AVAILABLE_PLAYERS_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- AVAILABLE PLAYERS -------------\n" COLOR_DEFAULT,
+    [MSG_GIVE_TO_OPTION] = "\n%d) Give the %s to %s;",
+    [MSG_OBJECT_GIVEN] = COLOR_MAGENTA "\nYou gave the %s to %s" COLOR_DEFAULT,
+    [MSG_RECEIVER_BACKPACK_FULL] = COLOR_YELLOW "\nThe selected player hasn't empty slots!" COLOR_DEFAULT,
+    [MSG_REMOVABLE_OBJECTS_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- REMOVABLE OBJECTS -------------\n" COLOR_DEFAULT,
+    [MSG_REMOVE_OPTION] = "\n%d) Remove the %s",
+    [MSG_OBJECT_REMOVED] = COLOR_MAGENTA "\nYou have removed the %s from the backpack!" COLOR_DEFAULT,
+    [MSG_BACKPACK_SLOTS_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- BACKPACK SLOTS -------------\n" COLOR_DEFAULT,
+    [MSG_SLOT_OPTION] = "\n%d) %s;",
+    [MSG_NOTHING_TO_REORGANIZE] = COLOR_YELLOW "\nAll the slots are empty, there's nothing to reorginize!" COLOR_DEFAULT,
+    [MSG_SWAP_WITH_MENU] = "\n5) Exit the menu.\nInsert the number of the slot to swap with the %s: ",
+    [MSG_SLOTS_SWAPPED] = COLOR_MAGENTA "\nSwapped the %s with the %s!" COLOR_DEFAULT,
+    [MSG_ELIMINATED] = COLOR_RED "\nYou have been eliminated because your mental health is less than 0!" COLOR_DEFAULT,
+    [MSG_CARAVAN_EVIDENCE_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- EVIDENCE COLLECTED IN THE CARAVAN -------------\n" COLOR_DEFAULT,
+    [MSG_EVIDENCE_OPTION] = "\n%d) %s",
+    [MSG_GHOST_INFO_SCREEN] = "\e[1;1H\e[2J\n" COLOR_MAGENTA "ROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- GHOST INFO -------------\n" COLOR_DEFAULT "\nGhost position: %s\nGhost appeareance probability: %d%%",
+};
+
+const char* getZoneName(int zone) {
+    if ((zone < 0) || (zone >= (int) (sizeof(zoneNames) / sizeof(zoneNames[0])))) {
+        return "-";
+    }
+
+    return zoneNames[zone];
+}
+
+const char* getObjectName(int object) {
+    if ((object < 0) || (object >= (int) (sizeof(objectNames) / sizeof(objectNames[0])))) {
+        return "-";
+    }
+
+    return objectNames[object];
+}
+
+bool buildCatalog(char* text, int textSize, catalogMessage id, ...) {
+    va_list params;
+
+    if (id >= CATALOG_SIZE) {
+        return FALSE;
+    }
+
+    va_start(params, id);
+    int textLen = vsnprintf(text, textSize, catalogTexts[id], params);
+    va_end(params);
+
+    return (textLen >= 0) && (textLen < textSize);
+}
+
+int encodeCatalog(char* buffer, int bufferSize, catalogMessage id, va_list params) {
+    uint16_t messageId = htons(id);
+    int length = sizeof(messageId);
+
+    if ((id >= CATALOG_SIZE) || (bufferSize < length)) {
+        return -1;
+    }
+
+    memcpy(buffer, &messageId, sizeof(messageId));
+
+    // Append the parameters in the same order of the placeholders
+    for (const char* c = catalogTexts[id]; *c != '\0'; c++) {
+        if ((*c != '%') || (*(++c) == '%')) {
+            continue;
+        }
+
+        if (*c == 'd') {
+            uint32_t value = htonl(va_arg(params, int));
+
+            if ((length + (int) sizeof(value)) > bufferSize) {
+                return -1;
+            }
+
+            memcpy(buffer + length, &value, sizeof(value));
+            length += sizeof(value);
+        } else if (*c == 's') {
+            char* value = va_arg(params, char*);
+            int valueLen = strlen(value);
+            uint16_t header = htons(valueLen);
+
+            if ((length + (int) sizeof(header) + valueLen) > bufferSize) {
+                return -1;
+            }
+
+            memcpy(buffer + length, &header, sizeof(header));
+            memcpy(buffer + length + sizeof(header), value, valueLen);
+            length += sizeof(header) + valueLen;
+        }
+    }
+
+    return length;
+}
+
+bool formatCatalog(char* payload, int payloadLen, char* text, int textSize) {
+    uint16_t messageId;
+    int offset = sizeof(messageId);
+    int textLen = 0;
+
+    if (payloadLen < offset) {
+        return FALSE;
+    }
+
+    memcpy(&messageId, payload, sizeof(messageId));
+    messageId = ntohs(messageId);
+
+    if (messageId >= CATALOG_SIZE) {
+        return FALSE;
+    }
+
+    for (const char* c = catalogTexts[messageId]; *c != '\0'; c++) {
+        // Leave the space for the string terminator
+        if (textLen >= (textSize - 1)) {
+            return FALSE;
+        }
+
+        // Copy the text as it is, except for the placeholders
+        if ((*c != '%') || (*(++c) == '%')) {
+            text[textLen] = *c;
+            textLen++;
+            continue;
+        }
+
+        if (*c == 'd') {
+            uint32_t value;
+
+            if ((offset + (int) sizeof(value)) > payloadLen) {
+                return FALSE;
+            }
+
+            memcpy(&value, payload + offset, sizeof(value));
+            offset += sizeof(value);
+
+            textLen += snprintf(text + textLen, textSize - textLen, "%d", (int) ntohl(value));
+        } else if (*c == 's') {
+            uint16_t valueLen;
+
+            if ((offset + (int) sizeof(valueLen)) > payloadLen) {
+                return FALSE;
+            }
+
+            memcpy(&valueLen, payload + offset, sizeof(valueLen));
+            valueLen = ntohs(valueLen);
+            offset += sizeof(valueLen);
+
+            if (((offset + valueLen) > payloadLen) || ((textLen + valueLen) >= textSize)) {
+                return FALSE;
+            }
+
+            memcpy(text + textLen, payload + offset, valueLen);
+            offset += valueLen;
+            textLen += valueLen;
+        }
+    }
+
+    text[textLen < textSize ? textLen : textSize - 1] = '\0';
+
+    return TRUE;
+}
@@ -1,174 +1,372 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <sys/socket.h>
-#include <arpa/inet.h>
-#include <string.h>
-#include <unistd.h>
-#include "client.h"
-#include "utils.h"
-
-typedef struct sockaddr_in sockaddr_in;
-
-static int socket_desc;
-static sockaddr_in server;
-
-static dataReceived* firstDataCollected = NULL;
-static dataReceived* lastDataCollected = NULL;
-int threadState = ACTIVE;
-
-bool sendData(char* message) {
-	char temp[2500];
-
-	// Copy the message in a array with fixed length
-	for (int i = 0; i < strlen(message) + 1; i++) {
-		temp[i] = message[i];
-	}
-
-	// Send the message
-	if (send(socket_desc, temp, 2500, 0) < 0) {
-		printf("\nFailed sending the message to the server!\n");
-		return FALSE;
-	}
-    
-	return TRUE;
-}
-
-char* getDataReceived() {
-	// Check if there's something to retrive
-	if (firstDataCollected == NULL) {
-		// Return the data requested
-		return NULL;
-	}
-
-	// Get the data from the element
-	char* dataContainer = firstDataCollected -> data;
-
-	// If the first element is the last element reset both
-	if (firstDataCollected == lastDataCollected) {
-		free(firstDataCollected);
-		firstDataCollected = NULL;
-		lastDataCollected = NULL;
-		// Return the data requested
-		return dataContainer;
-	}
-
-	// Copy the address of the first address
-	dataReceived* temp = firstDataCollected;
-
-	// Make the second element the first
-	firstDataCollected = firstDataCollected -> next;
-
-    // Deallocate the first element
-    free(temp);
-
-	// Return the data requested
-	return dataContainer;
-}
-
-static void saveDataReceived(char* dataRecv) {
-	// Create a new element
-	dataReceived* newData = (dataReceived*) malloc(sizeof(dataReceived));
-
-	// Set the given string in the data collection
-	newData -> data = dataRecv; 
-
-	// Set the next pointer as the last element
-	newData -> next = NULL;
-
-	// If the first element hasn't been created, create it
-	if (firstDataCollected == NULL) {
-		// Set the first element and the last element
-		firstDataCollected = newData;
-
-		// Set the last element equal to the first element as the list has only one element
-		lastDataCollected = firstDataCollected;
-
-		// Set the last element as the next one
-		firstDataCollected -> next = lastDataCollected;
-		
-		return;
-	}
-
-	// The old last element points to the new
-	lastDataCollected -> next = newData;
-
-	// Set the last element as this new element
-	lastDataCollected = newData;
-
-	return;
-}
-
-void* receiveData() {
-	// Set the exit for the recursion
-	if (!threadState) {
-		return NULL;
-	}
-
-	char* response = (char*) calloc(2500, 1);
-
-	int total_received = 0, received = 0;
-	do {
-		received = recv(socket_desc, response + total_received, 2500 - total_received, 0);
-		if (received == -1) {
-			printf("\nrecv() failed.");
-			return receiveData();
-		}
-
-		if (received > 0) {
-			total_received += received;
-		}
-
-	} while (received != 0);
-
-	// Save the data received
-	response[total_received] = 0;
-	saveDataReceived(response);
-	
-	return receiveData();
-}
-
-bool initClient() {
-	// Regex to clear the terminal.
-    printf("\e[1;1H\e[2J");
-
-	// Request the ip address
-	char ip_addrs[255];
-	printf("\nInsert the ip address: ");
-	fgets(ip_addrs, 255, stdin);
-	char* temp = strchr(ip_addrs, '\n');
-	
-	if (temp != NULL) {
-		*temp = '\0';
-	}
-	
-	printf("\nTrying to connect to the server at ip address: %s!\n", ip_addrs);
-
-	// Create the socket 
-	if ((socket_desc = socket(AF_INET, SOCK_STREAM, 0)) == -1) {
-		printf("\nCould not create socket\n");
-		return FALSE;
-	}
-
-	// Set the host info for connection (ip, family, port)
-	server.sin_addr.s_addr = inet_addr(ip_addrs);
-	server.sin_family = AF_INET;
-	server.sin_port = htons(8080);
-
-	// Connect to the server
-	if (connect(socket_desc, (struct sockaddr*) &server, sizeof(server)) < 0) {
-		printf("\nFailed connecting to the server!\n");
-		return FALSE;
-	}
-	
-	// Regex to clear the terminal.
-    printf("\e[1;1H\e[2J");
-
-	printf("\x1b[1;33m\nWaiting the game master to select the game settings...\x1b[1;0m");
-
-	return TRUE;
-}
-
-void closeClient() {
-	close(socket_desc);
-	return;
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include "client.h"
+#include "utils.h"
+#include "pool.h"
+
+#define INPUT_BUFFER_SIZE 512
+#define POOL_BLOCKS 32
+
+typedef struct sockaddr_in sockaddr_in;
+typedef struct pollfd pollfd;
+
+static int socket_desc = -1;
+static sockaddr_in server;
+
+static dataReceived* firstDataCollected = NULL;
+static dataReceived* lastDataCollected = NULL;
+static int connectionState = INACTIVE;
+static int inputState = ACTIVE;
+static char receiveBuffer[HEADER_SIZE + MAX_MESSAGE_SIZE];
+static int receivedBytes = 0;
+static char inputBuffer[INPUT_BUFFER_SIZE];
+static int inputLen = 0;
+static memoryPool messagesPool;
+static memoryPool nodesPool;
+
+/// @brief Send all the given bytes, even if the socket accepts only a part of them at a time.
+/// @param data
+/// @param dataLen
+/// @return Return the status of the operation.
+static bool sendAll(char* data, int dataLen) {
+	int total_sent = 0;
+
+	while (total_sent < dataLen) {
+		int sent = send(socket_desc, data + total_sent, dataLen - total_sent, 0);
+
+		if (sent == -1) {
+			return FALSE;
+		}
+
+		total_sent += sent;
+	}
+
+	return TRUE;
+}
+
+bool sendMessage(protocolOpcode opcode, char* payload, int payloadLen) {
+	char temp[HEADER_SIZE + MAX_MESSAGE_SIZE];
+
+	// Check that the payload fits in a single frame
+	if (payloadLen > MAX_MESSAGE_SIZE) {
+		printf("\nThe message is too long!\n");
+		return FALSE;
+	}
+
+	// Prepend the header of the message
+	messageHeader header = {PROTOCOL_VERSION, opcode, NO_FLAGS, payloadLen};
+	encodeHeader(temp, header);
+	if (payloadLen > 0) {
+		memcpy(temp + HEADER_SIZE, payload, payloadLen);
+	}
+
+	// Send the message
+	if (!sendAll(temp, HEADER_SIZE + payloadLen)) {
+		printf("\nFailed sending the message to the server!\n");
+		return FALSE;
+	}
+    
+	return TRUE;
+}
+
+static void saveDataReceived(char* dataRecv, int dataLen, protocolOpcode opcode, protocolFlags flags) {
+	// Create a new element
+	dataReceived* newData = (dataReceived*) poolAlloc(&nodesPool, sizeof(dataReceived));
+
+	// Set the given string in the data collection
+	newData -> data = dataRecv; 
+
+	newData -> length = dataLen;
+
+	newData -> opcode = opcode;
+
+	newData -> flags = flags;
+
+	// Set the next pointer as the last element
+	newData -> next = NULL;
+
+	// If the first element hasn't been created, create it
+	if (firstDataCollected == NULL) {
+		// Set the first element and the last element
+		firstDataCollected = newData;
+
+		// Set the last element equal to the first element as the list has only one element
+		lastDataCollected = firstDataCollected;
+
+		// Set the last element as the next one
+		firstDataCollected -> next = lastDataCollected;
+		
+		return;
+	}
+
+	// The old last element points to the new
+	lastDataCollected -> next = newData;
+
+	// Set the last element as this new element
+	lastDataCollected = newData;
+
+	return;
+}
+
+/// @brief Read all the bytes available from the server without blocking, and save every complete message.
+/// @return Return FALSE if the connection with the server has been closed.
+static bool receiveData() {
+	while (TRUE) {
+		int received = recv(socket_desc, receiveBuffer + receivedBytes, (HEADER_SIZE + MAX_MESSAGE_SIZE) - receivedBytes, MSG_DONTWAIT);
+
+		if (received == -1) {
+			// Stop when there's nothing else to read
+			if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+				return TRUE;
+			}
+
+			printf("\nrecv() failed.");
+			return FALSE;
+		} else if (received == 0) {
+			return FALSE;
+		}
+
+		receivedBytes += received;
+
+		// Save every message that has been completely received
+		while (receivedBytes >= HEADER_SIZE) {
+			messageHeader header = decodeHeader(receiveBuffer);
+			uint32_t dataLen = header.length;
+
+			// Only the versions of the protocol that are known can be read
+			if ((dataLen > MAX_MESSAGE_SIZE) || (header.opcode >= OPCODES_COUNT) || (header.version < MIN_PROTOCOL_VERSION) || (header.version > PROTOCOL_VERSION)) {
+				printf("\nThe server has sent an invalid message!");
+				return FALSE;
+			}
+
+			// Wait till the whole message has been received
+			if (receivedBytes < (HEADER_SIZE + dataLen)) {
+				break;
+			}
+
+			char* response = (char*) poolAlloc(&messagesPool, dataLen + 1);
+			memcpy(response, receiveBuffer + HEADER_SIZE, dataLen);
+			response[dataLen] = 0;
+			saveDataReceived(response, dataLen, header.opcode, header.flags);
+
+			// Move the bytes of the next message at the start of the buffer
+			receivedBytes -= HEADER_SIZE + dataLen;
+			memmove(receiveBuffer, receiveBuffer + HEADER_SIZE + dataLen, receivedBytes);
+		}
+	}
+}
+
+/// @brief Read what the user has typed, without blocking.
+static void receiveInput() {
+	// If the buffer is full, without a complete line, throw away what has been typed
+	if (inputLen == INPUT_BUFFER_SIZE) {
+		inputLen = 0;
+	}
+
+	int received = read(STDIN_FILENO, inputBuffer + inputLen, INPUT_BUFFER_SIZE - inputLen);
+
+	if (received == -1) {
+		if (errno != EINTR) {
+			inputState = INACTIVE;
+		}
+		return;
+	} else if (received == 0) {
+		inputState = INACTIVE;
+		return;
+	}
+
+	inputLen += received;
+
+	return;
+}
+
+/// @brief Sleep till the server sends something or the user types something, then handle it.
+/// @return Return FALSE if the connection with the server has been closed.
+static bool pollEvents() {
+	// Show everything printed before going to sleep
+	fflush(stdout);
+
+	pollfd fds[2] = {
+		{connectionState ? socket_desc : -1, POLLIN, 0},
+		{inputState ? STDIN_FILENO : -1, POLLIN, 0}
+	};
+
+	if (poll(fds, 2, -1) == -1) {
+		return (errno == EINTR);
+	}
+
+	if (fds[1].revents & (POLLIN | POLLHUP | POLLERR)) {
+		receiveInput();
+	}
+
+	if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+		if (!receiveData()) {
+			printf("\nThe connection with the server has been closed.\n");
+			connectionState = INACTIVE;
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+dataReceived getDataReceived() {
+	// Wait till the server sends something
+	while (firstDataCollected == NULL) {
+		if (!connectionState || !pollEvents()) {
+			dataReceived dataContainer = {NULL, 0, OP_HELLO, NO_FLAGS, NULL};
+			return dataContainer;
+		}
+	}
+
+	// Get the data from the element
+	dataReceived dataContainer = *firstDataCollected;
+	dataContainer.next = NULL;
+
+	// If the first element is the last element reset both
+	if (firstDataCollected == lastDataCollected) {
+		poolFree(&nodesPool, firstDataCollected);
+		firstDataCollected = NULL;
+		lastDataCollected = NULL;
+		// Return the data requested
+		return dataContainer;
+	}
+
+	// Copy the address of the first address
+	dataReceived* temp = firstDataCollected;
+
+	// Make the second element the first
+	firstDataCollected = firstDataCollected -> next;
+
+    // Give back the element to the pool
+    poolFree(&nodesPool, temp);
+
+	// Return the data requested
+	return dataContainer;
+}
+
+void releaseData(char* data) {
+	poolFree(&messagesPool, data);
+	return;
+}
+
+bool readInput(char* input, int inputSize) {
+	char* newline;
+
+	// Wait till the user types a whole line
+	while ((newline = memchr(inputBuffer, '\n', inputLen)) == NULL) {
+		// Use what remains if nothing else can be typed
+		if (!inputState) {
+			if (inputLen == 0) {
+				return FALSE;
+			}
+			newline = inputBuffer + inputLen;
+			break;
+		}
+
+		if (!pollEvents()) {
+			return FALSE;
+		}
+	}
+
+	// Copy the line without the newline, truncating it if it doesn't fit
+	int lineLen = newline - inputBuffer;
+	int copyLen = lineLen < (inputSize - 1) ? lineLen : (inputSize - 1);
+	memcpy(input, inputBuffer, copyLen);
+	input[copyLen] = '\0';
+
+	// Remove the line from the buffer
+	int consumed = lineLen < inputLen ? lineLen + 1 : lineLen;
+	inputLen -= consumed;
+	memmove(inputBuffer, inputBuffer + consumed, inputLen);
+
+	return TRUE;
+}
+
+/// @brief Send the versions of the protocol supported, and wait the one chosen by the server.
+/// @return Return the status of the operation.
+static bool negotiateProtocol() {
+	char versions[2] = {MIN_PROTOCOL_VERSION, PROTOCOL_VERSION};
+
+	if (!sendMessage(OP_HELLO, versions, 2)) {
+		return FALSE;
+	}
+
+	dataReceived hello = getDataReceived();
+
+	if (hello.data == NULL) {
+		return FALSE;
+	}
+
+	// The server answers with the version chosen, or 0 if there's none
+	bool status = (hello.opcode == OP_HELLO) && (hello.length == 1) && (hello.data[0] >= MIN_PROTOCOL_VERSION) && (hello.data[0] <= PROTOCOL_VERSION);
+
+	releaseData(hello.data);
+
+	return status;
+}
+
+bool initClient() {
+	// Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+
+	// Request the ip address
+	char ip_addrs[255];
+	printf("\nInsert the ip address: ");
+	if (!readInput(ip_addrs, 255)) {
+		return FALSE;
+	}
+	
+	printf("\nTrying to connect to the server at ip address: %s!\n", ip_addrs);
+
+	// Create the socket 
+	if ((socket_desc = socket(AF_INET, SOCK_STREAM, 0)) == -1) {
+		printf("\nCould not create socket\n");
+		return FALSE;
+	}
+
+	// Set the host info for connection (ip, family, port)
+	server.sin_addr.s_addr = inet_addr(ip_addrs);
+	server.sin_family = AF_INET;
+	server.sin_port = htons(8080);
+
+	// Connect to the server
+	if (connect(socket_desc, (struct sockaddr*) &server, sizeof(server)) < 0) {
+		printf("\nFailed connecting to the server!\n");
+		return FALSE;
+	}
+
+	connectionState = ACTIVE;
+
+	// Preallocate the memory for the messages, so that the game doesn't need to allocate it every turn
+	initPool(&messagesPool, MAX_MESSAGE_SIZE + 1, POOL_BLOCKS);
+	initPool(&nodesPool, sizeof(dataReceived), POOL_BLOCKS);
+
+	// Agree with the server on the protocol to use
+	if (!negotiateProtocol()) {
+		printf("\nThe server doesn't support this version of the game!\n");
+		return FALSE;
+	}
+	
+	// Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+
+	printf("\x1b[1;33m\nWaiting the game master to select the game settings...\x1b[1;0m");
+
+	return TRUE;
+}
+
+void closeClient() {
+	connectionState = INACTIVE;
+	close(socket_desc);
+
+	printPoolStats(&messagesPool, "Messages");
+	printPoolStats(&nodesPool, "Nodes");
+	return;
+}
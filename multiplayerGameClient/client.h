@@ -1,30 +1,38 @@
-//NOTE: This the core client header, where are contained all the functions necessary to communicate between users.
-
-#pragma once
-
-#ifndef _CLIENT_H
-#define _CLIENT_H
-#endif
-
-#include <sys/socket.h>
-#include "utils.h"
-
-/// @brief Init the client with its basic functions.
-/// @return Return the status of the operation.
-bool initClient();
-
-/// @brief Send the data to the given target.
-/// @param message 
-/// @param msgLen 
-/// @return Return the status of the operation.
-bool sendData(char* message);
-
-/// @brief Receive the data from the given target.
-void* receiveData();
-
-/// @brief Retrieve the data sent by the server.
-/// @return Return the most recent message received, if there's.
-char* getDataReceived();
-
-/// @brief Close the client socket and deallocate the memory used.
-void closeClient();
+//NOTE: This the core client header, where are contained all the functions necessary to communicate between users.
+
+#pragma once
+
+#ifndef _CLIENT_H
+#define _CLIENT_H
+#endif
+
+#include <sys/socket.h>
+#include "utils.h"
+
+/// @brief Init the client with its basic functions.
+/// @return Return the status of the operation.
+bool initClient();
+
+/// @brief Send a message with the given opcode to the server.
+/// @param opcode 
+/// @param payload 
+/// @param payloadLen 
+/// @return Return the status of the operation.
+bool sendMessage(protocolOpcode opcode, char* payload, int payloadLen);
+
+/// @brief Retrieve the data sent by the server, sleeping till something arrives.
+/// @return Return the oldest message received, its data is NULL if the connection has been closed.
+dataReceived getDataReceived();
+
+/// @brief Give back the memory of a message retrieved with getDataReceived.
+/// @param data 
+void releaseData(char* data);
+
+/// @brief Read a line typed by the user, without the newline, while still receiving the data sent by the server.
+/// @param input 
+/// @param inputSize 
+/// @return Return the status of the operation.
+bool readInput(char* input, int inputSize);
+
+/// @brief Close the client socket and deallocate the memory used.
+void closeClient();
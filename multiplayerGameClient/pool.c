@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "pool.h"
+
+// Every block must be able to store the pointer to the next free block, and must be aligned
+#define BLOCK_ALIGNMENT 16
+
+bool initPool(memoryPool* pool, size_t blockSize, int blocksCount) {
+    // Round the size of the blocks to keep them aligned
+    blockSize = (blockSize + BLOCK_ALIGNMENT - 1) & ~((size_t) BLOCK_ALIGNMENT - 1);
+
+    pool -> blockSize = blockSize;
+    pool -> blocksCount = blocksCount;
+    pool -> freeBlocks = NULL;
+    pool -> hits = 0;
+    pool -> misses = 0;
+    pthread_mutex_init(&(pool -> lock), NULL);
+
+    // Allocate all the blocks at once
+    if ((pool -> slab = (unsigned char*) malloc(blockSize * blocksCount)) == NULL) {
+        pool -> blocksCount = 0;
+        return FALSE;
+    }
+
+    // Chain all the blocks in the list of free blocks
+    for (int i = blocksCount - 1; i >= 0; i--) {
+        void** block = (void**) (pool -> slab + (i * blockSize));
+        *block = pool -> freeBlocks;
+        pool -> freeBlocks = block;
+    }
+
+    return TRUE;
+}
+
+void* poolAlloc(memoryPool* pool, size_t size) {
+    pthread_mutex_lock(&(pool -> lock));
+
+    // Use a free block if the requested size fits in it
+    if ((size <= pool -> blockSize) && (pool -> freeBlocks != NULL)) {
+        void** block = (void**) pool -> freeBlocks;
+        pool -> freeBlocks = *block;
+        pool -> hits++;
+        pthread_mutex_unlock(&(pool -> lock));
+        return block;
+    }
+
+    pool -> misses++;
+    pthread_mutex_unlock(&(pool -> lock));
+
+    return malloc(size);
+}
+
+void poolFree(memoryPool* pool, void* block) {
+    if (block == NULL) {
+        return;
+    }
+
+    // Check if the block belongs to the slab, otherwise it has been allocated with malloc
+    uintptr_t address = (uintptr_t) block;
+    uintptr_t slabStart = (uintptr_t) pool -> slab;
+    if ((pool -> slab == NULL) || (address < slabStart) || (address >= (slabStart + (pool -> blockSize * pool -> blocksCount)))) {
+        free(block);
+        return;
+    }
+
+    pthread_mutex_lock(&(pool -> lock));
+
+    // Put the block back on top of the list of free blocks
+    *((void**) block) = pool -> freeBlocks;
+    pool -> freeBlocks = block;
+
+    pthread_mutex_unlock(&(pool -> lock));
+
+    return;
+}
+
+void printPoolStats(memoryPool* pool, char* poolName) {
+    pthread_mutex_lock(&(pool -> lock));
+    printf("\n%s pool: %lu hits, %lu misses", poolName, pool -> hits, pool -> misses);
+    pthread_mutex_unlock(&(pool -> lock));
+
+    return;
+}
+
+void destroyPool(memoryPool* pool) {
+    free(pool -> slab);
+    pool -> slab = NULL;
+    pool -> freeBlocks = NULL;
+    pool -> blocksCount = 0;
+    pthread_mutex_destroy(&(pool -> lock));
+
+    return;
+}
@@ -0,0 +1,48 @@
+//NOTE: This file contains the pools used to recycle the memory of the messages exchanged, instead of allocating it every time.
+
+#pragma once
+
+#ifndef _POOL_H
+#define _POOL_H
+#endif
+
+#include <stddef.h>
+#include <pthread.h>
+#include "utils.h"
+
+typedef struct memoryPool {
+    unsigned char* slab;
+    size_t blockSize;
+    int blocksCount;
+    void* freeBlocks;
+    unsigned long hits;
+    unsigned long misses;
+    pthread_mutex_t lock;
+} memoryPool;
+
+/// @brief Allocate all the blocks of the pool with a single allocation.
+/// @param pool 
+/// @param blockSize 
+/// @param blocksCount 
+/// @return Return the status of the operation.
+bool initPool(memoryPool* pool, size_t blockSize, int blocksCount);
+
+/// @brief Get a block from the pool, if the pool is empty or the size requested is too big fallback to malloc.
+/// @param pool 
+/// @param size 
+/// @return Return the block allocated.
+void* poolAlloc(memoryPool* pool, size_t size);
+
+/// @brief Give back a block to the pool, or free it if it was allocated with malloc.
+/// @param pool 
+/// @param block 
+void poolFree(memoryPool* pool, void* block);
+
+/// @brief Print the number of allocations served by the pool and the number of allocations that used malloc.
+/// @param pool 
+/// @param poolName 
+void printPoolStats(memoryPool* pool, char* poolName);
+
+/// @brief Deallocate the memory used by the pool.
+/// @param pool 
+void destroyPool(memoryPool* pool);
@@ -1,174 +1,268 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "network.h"
-#include "utils.h"
-#include "client.h"
-
-static const char* colorsCodes[] = {"\x1b[1;30m", "\x1b[1;31m", "\x1b[1;32m", "\x1b[1;33m", "\x1b[1;34m", "\x1b[1;35m", "\x1b[1;36m", "\x1b[1;37m", "\x1b[1;0m"};
-
-static void printColored(char* str, ColorType color) {
-    printf("%s%s%s", colorsCodes[color], str, colorsCodes[DEFAULT_COLOR]);
-    return;
-}
-
-void setPlayer() {
-    // Regex to clear the terminal.
-    printf("\e[1;1H\e[2J");
-
-    printColored("\n------------- PLAYER INFO -------------\n", MAGENTA);
-
-    // Allocate the space in the heap for the player struct
-    Player player = {"", INACTIVE};
-
-    // Allocate the space for the player's name
-    player.playerName = (char*) calloc(225, 1);
-
-    // Get the player's name
-    do {
-        printf("\nInsert the name to use in game%s (MAX 225 characters)%s: ", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-
-        fgets(player.playerName, 225, stdin);
-
-        // Check if the input string contains the newline character
-        char* temp = strchr(player.playerName, '\n');
-
-        if (temp!= NULL) {
-            // Change the newline with the string terminator
-            *temp = '\0';
-
-            // Resize the size of the name array
-            player.playerName = (char*) realloc(player.playerName, strlen(player.playerName) + 1);
-        } else {
-            // If the input string doesn't contain the newline than clean the stdin
-            char c;
-            while((c = getc(stdin)) != EOF) {
-                if(c == '\n') {
-                    break;          
-                }
-            }
-
-            // Change the newline with the string terminator
-            *temp = '\0';
-        }
-            
-        // Check if the given input string is empty or not
-        int isEmpty = 1;
-        for (int i = 0; player.playerName[i] != '\0'; i++) {
-            if ((player.playerName[i] != ' ')) {
-                isEmpty = 0;
-                break;
-            }
-        }
-
-        if (isEmpty) {
-            printColored("\nError: please insert a valid input!\n", RED);
-            continue;
-        } else {
-            break;
-        }
-
-    } while (TRUE);
-
-    // Ask if the player wants advice during the game
-    do {
-        char confirm;
-        printColored("\nDo you want to receive advices during the game? (Y/N): ", YELLOW);
-        scanf("%c", &confirm);
-
-        if (confirm == 'Y') {
-            player.useAdvices = ACTIVE;
-            break;
-        } else if (confirm == 'N') {
-            player.useAdvices = INACTIVE;
-            break;
-        }
-
-        printColored("\nError: please insert a valid input!\n", RED);
-
-    } while (TRUE);
-
-    {
-        // Clean the stdin
-        char c;
-        while ((c = getc(stdin)) != EOF) {
-            if (c == '\n'){
-                break;
-            }
-        }
-
-        char confirm;
-        printColored("\n\nPress ENTER to continue: ", YELLOW);
-        scanf("%c", &confirm);
-    }
-
-    // Send the player data to the server
-    sendPlayerData(player);
-
-    free(player.playerName);
-
-    return;
-}
-
-static void sendInput() {
-    char* temp = (char *) calloc(50, 1);
-    fgets(temp, 50, stdin);
-    temp = (char*) realloc(temp, strlen(temp) + 1);
-    
-    if (!sendData(temp)) {
-        printf("\nError while sending the data to the server!");
-    }
-
-    free(temp);
-
-    return;
-}
-
-void playTurn() {
-    while (TRUE) {
-        // Wait to know if it's your turn
-        char* temp;
-        while ((temp = getDataReceived()) == NULL);
-
-        // If it's not your turn wait the end of the turn
-        if (!strcmp(temp, "NYT")) {
-            bool endGameCondition;
-            
-            while (!strcmp(temp, "TT") || (endGameCondition = !strcmp(temp, "TG"))) {
-                while ((temp = getDataReceived()) == NULL);
-                printf("%s", temp);
-            }
-
-            free(temp);
-
-            // Check if the game ended
-            if (endGameCondition) {
-                return;
-            }
-        
-        }
-
-        do {
-            // Get the instructions from the game
-            while ((temp = getDataReceived()) == NULL);
-            
-            // Check if the user input is needed
-            if (!strcmp(temp, "UI")) {
-                free(temp);
-                sendInput();
-                continue;
-            }
-
-            // Wait to know if the turn is ended
-            if (!strcmp(temp, "TT")) {
-                free(temp);
-                break;
-            }
-
-            // Print the info
-            printf("%s", temp);
-            free(temp);
-
-        } while(TRUE);
-    }
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "network.h"
+#include "utils.h"
+#include "client.h"
+#include "catalog.h"
+
+static const char* colorsCodes[] = {"\x1b[1;30m", "\x1b[1;31m", "\x1b[1;32m", "\x1b[1;33m", "\x1b[1;34m", "\x1b[1;35m", "\x1b[1;36m", "\x1b[1;37m", "\x1b[1;0m"};
+static char playerName[225];
+static unsigned short gameState[STATE_FIELDS_COUNT];
+
+static void printColored(char* str, ColorType color) {
+    printf("%s%s%s", colorsCodes[color], str, colorsCodes[DEFAULT_COLOR]);
+    return;
+}
+
+bool setPlayer() {
+    // Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+
+    printColored("\n------------- PLAYER INFO -------------\n", MAGENTA);
+
+    // Allocate the space in the heap for the player struct
+    Player player = {"", INACTIVE};
+
+    // Allocate the space for the player's name
+    player.playerName = (char*) calloc(225, 1);
+
+    // Get the player's name
+    do {
+        printf("\nInsert the name to use in game%s (MAX 225 characters)%s: ", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
+
+        // The line is read without the newline, and the characters that don't fit are discarded
+        if (!readInput(player.playerName, 225)) {
+            free(player.playerName);
+            return FALSE;
+        }
+            
+        // Check if the given input string is empty or not
+        int isEmpty = 1;
+        for (int i = 0; player.playerName[i] != '\0'; i++) {
+            if ((player.playerName[i] != ' ')) {
+                isEmpty = 0;
+                break;
+            }
+        }
+
+        if (isEmpty) {
+            printColored("\nError: please insert a valid input!\n", RED);
+            continue;
+        } else {
+            break;
+        }
+
+    } while (TRUE);
+
+    // Resize the size of the name array
+    player.playerName = (char*) realloc(player.playerName, strlen(player.playerName) + 1);
+
+    // Ask if the player wants advice during the game
+    do {
+        char confirm[3];
+        printColored("\nDo you want to receive advices during the game? (Y/N): ", YELLOW);
+        readInput(confirm, 3);
+
+        if (!strcmp(confirm, "Y")) {
+            player.useAdvices = ACTIVE;
+            break;
+        } else if (!strcmp(confirm, "N")) {
+            player.useAdvices = INACTIVE;
+            break;
+        }
+
+        printColored("\nError: please insert a valid input!\n", RED);
+
+    } while (TRUE);
+
+    {
+        char confirm[2];
+        printColored("\n\nPress ENTER to continue: ", YELLOW);
+        readInput(confirm, 2);
+    }
+
+    // Keep the name to show it in the screens
+    strcpy(playerName, player.playerName);
+
+    // Send the player data to the server
+    bool status = sendPlayerData(player);
+
+    free(player.playerName);
+
+    return status;
+}
+
+/// @brief Send the line typed by the user.
+/// @return Return FALSE if the user can't type anymore or the data can't be sent.
+static bool sendInput() {
+    char temp[50];
+    if (!readInput(temp, 50)) {
+        return FALSE;
+    }
+    
+    if (!sendMessage(OP_INPUT, temp, strlen(temp))) {
+        printf("\nError while sending the data to the server!");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/// @brief Print the text sent by the server.
+/// @param message 
+/// @return Return the status of the operation.
+static bool printText(dataReceived* message) {
+    printf("%s", message -> data);
+    return TRUE;
+}
+
+/// @brief Print a text of the catalog, built with the parameters sent by the server.
+/// @param message 
+/// @return Return the status of the operation.
+static bool printCatalog(dataReceived* message) {
+    char text[MAX_TEXT_SIZE];
+
+    if (!formatCatalog(message -> data, message -> length, text, MAX_TEXT_SIZE)) {
+        printf("\nThe server has sent an invalid message!");
+        return TRUE;
+    }
+
+    printf("%s", text);
+    return TRUE;
+}
+
+/// @brief Update the game state with the fields sent by the server.
+/// @param message 
+/// @return Return the status of the operation.
+static bool updateState(dataReceived* message) {
+    // A snapshot replaces the whole state
+    if (message -> flags & STATE_SNAPSHOT) {
+        memset(gameState, 0, sizeof(gameState));
+    }
+
+    for (int i = 0; (i + STATE_ENTRY_SIZE) <= message -> length; i += STATE_ENTRY_SIZE) {
+        uint8_t field;
+        uint16_t value;
+        decodeStateEntry(message -> data + i, &field, &value);
+
+        if (field < STATE_FIELDS_COUNT) {
+            gameState[field] = value;
+        }
+    }
+
+    return TRUE;
+}
+
+/// @brief Render the screen requested by the server, using the game state.
+/// @param message 
+/// @return Return the status of the operation.
+static bool renderScreen(dataReceived* message) {
+    char text[MAX_TEXT_SIZE];
+    int round = gameState[STATE_ROUND];
+    int turn = gameState[STATE_TURN];
+
+    if (message -> length < 1) {
+        return TRUE;
+    }
+
+    switch (message -> data[0]) {
+        case SCREEN_PLAYER_INFO:
+            {
+                char* useAdv = gameState[STATE_USE_ADVICES] ? "\nThe advices are active" : "\nThe advices are inactive";
+                char* useSalt = gameState[STATE_SALT_PROTECTION] ? "\nThe salt protection is active" : "\nThe salt protection is inactive";
+                if (buildCatalog(text, MAX_TEXT_SIZE, MSG_PLAYER_INFO_SCREEN, round, turn, playerName, getZoneName(gameState[STATE_GHOST_POSITION]), gameState[STATE_GHOST_APPEARANCE], playerName, gameState[STATE_MENTAL_HEALTH], getZoneName(gameState[STATE_POSITION]), useAdv, useSalt)) {
+                    printf("%s", text);
+                }
+
+                // Print the backpack's slots
+                for (int i = 0; i < 4; i++) {
+                    if (buildCatalog(text, MAX_TEXT_SIZE, MSG_BACKPACK_SLOT, (i + 1), getObjectName(gameState[STATE_BACKPACK + i]))) {
+                        printf("%s", text);
+                    }
+                }
+            }
+            break;
+
+        case SCREEN_ZONE_INFO:
+            if (buildCatalog(text, MAX_TEXT_SIZE, MSG_ZONE_INFO_SCREEN, round, turn, playerName, getZoneName(gameState[STATE_POSITION]), getObjectName(gameState[STATE_ZONE_EVIDENCE]), getObjectName(gameState[STATE_ZONE_OBJECT]), getZoneName(gameState[STATE_NEXT_ZONE]))) {
+                printf("%s", text);
+            }
+            break;
+
+        case SCREEN_CARAVAN_EVIDENCE:
+            if (buildCatalog(text, MAX_TEXT_SIZE, MSG_CARAVAN_EVIDENCE_SCREEN, round, turn, playerName)) {
+                printf("%s", text);
+            }
+
+            for (int i = 0; i < 3; i++) {
+                if (buildCatalog(text, MAX_TEXT_SIZE, MSG_EVIDENCE_OPTION, (i + 1), getObjectName(gameState[STATE_CARAVAN_EVIDENCE + i]))) {
+                    printf("%s", text);
+                }
+            }
+            break;
+
+        case SCREEN_GHOST_INFO:
+            if (buildCatalog(text, MAX_TEXT_SIZE, MSG_GHOST_INFO_SCREEN, round, turn, playerName, getZoneName(gameState[STATE_GHOST_POSITION]), gameState[STATE_GHOST_APPEARANCE])) {
+                printf("%s", text);
+            }
+            break;
+    }
+
+    return TRUE;
+}
+
+/// @brief Set the player when the server asks for it.
+/// @param message 
+/// @return Return the status of the operation.
+static bool sendPlayerInfo(dataReceived* message) {
+    return setPlayer();
+}
+
+/// @brief Send the input requested by the server.
+/// @param message 
+/// @return Return the status of the operation.
+static bool sendUserInput(dataReceived* message) {
+    return sendInput();
+}
+
+/// @brief Stop handling the messages as the game has ended.
+/// @param message 
+/// @return Return FALSE to stop.
+static bool terminateGame(dataReceived* message) {
+    return FALSE;
+}
+
+typedef bool (*messageHandler)(dataReceived* message);
+
+// The handler of every opcode, the ones without a handler are ignored
+static const messageHandler handlers[OPCODES_COUNT] = {
+    [OP_TEXT] = printText,
+    [OP_SEND_PLAYER_INFO] = sendPlayerInfo,
+    [OP_USER_INPUT] = sendUserInput,
+    [OP_TERMINATE_GAME] = terminateGame,
+    [OP_CATALOG] = printCatalog,
+    [OP_STATE] = updateState,
+    [OP_SCREEN] = renderScreen
+};
+
+void playTurn() {
+    while (TRUE) {
+        // Wait the next message
+        dataReceived message = getDataReceived();
+        if (message.data == NULL) {
+            return;
+        }
+
+        bool status = TRUE;
+        if (handlers[message.opcode] != NULL) {
+            status = handlers[message.opcode](&message);
+        }
+
+        releaseData(message.data);
+
+        if (!status) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,111 @@
+//NOTE: This file contains the catalog of the texts shown to the players, compiled in both the server and the client, so that only the id and the parameters of a text are sent.
+
+#pragma once
+
+#ifndef _CATALOG_H
+#define _CATALOG_H
+#endif
+
+#include <stdarg.h>
+#include "utils.h"
+
+// The longest text that can be obtained from a message of the catalog
+#define MAX_TEXT_SIZE (2 * MAX_MESSAGE_SIZE)
+
+// Changing the catalog changes the protocol, so PROTOCOL_VERSION must be increased too
+typedef enum catalogMessage {
+    MSG_ACTION_MENU,
+    MSG_USE_MENU,
+    MSG_BUY_MENU,
+    MSG_EXIT_MENU,
+    MSG_SWAP_MENU,
+    MSG_TURN_BANNER,
+    MSG_WAIT_TURN_END,
+    MSG_PRESS_ENTER,
+    MSG_EVIDENCE_LEFT,
+    MSG_NO_EVIDENCES,
+    MSG_REPOSITIONED_FIRST_ZONE,
+    MSG_PLAYER_INFO_SCREEN,
+    MSG_BACKPACK_SLOT,
+    MSG_ZONE_INFO_SCREEN,
+    MSG_OBJECT_ADDED,
+    MSG_REPOSITIONED,
+    MSG_EVIDENCE_CHANGED,
+    MSG_NO_PICKABLE_OBJECT,
+    MSG_EVIDENCE_PICKED,
+    MSG_GHOST_SPAWNED,
+    MSG_GHOST_ATTACK,
+    MSG_GHOST_PROBABILITY_INCREASED,
+    MSG_MISSING_EVIDENCE_OBJECT,
+    MSG_NO_ZONE_OBJECTS,
+    MSG_OBJECT_PICKED,
+    MSG_BACKPACK_FULL,
+    MSG_USABLE_OBJECTS_SCREEN,
+    MSG_USE_OPTION,
+    MSG_NO_USABLE_OBJECTS,
+    MSG_INVALID_INPUT,
+    MSG_OBJECTS_INFO_SCREEN,
+    MSG_PRESS_ENTER_SPACED,
+    MSG_SEDATIVE_USED,
+    MSG_SALT_USED,
+    MSG_ADRENALINE_USED,
+    MSG_TRANQUILLIZER_BOUGHT,
+    MSG_SALT_BOUGHT,
+    MSG_KNIFE_KILLED,
+    MSG_KNIFE_MISSED,
+    MSG_TRANQUILLIZER_USED,
+    MSG_SELF_TRADE,
+    MSG_GIVABLE_OBJECTS_SCREEN,
+    MSG_GIVE_OPTION,
+    MSG_AVAILABLE_PLAYERS_SCREEN,
+    MSG_GIVE_TO_OPTION,
+    MSG_OBJECT_GIVEN,
+    MSG_RECEIVER_BACKPACK_FULL,
+    MSG_REMOVABLE_OBJECTS_SCREEN,
+    MSG_REMOVE_OPTION,
+    MSG_OBJECT_REMOVED,
+    MSG_BACKPACK_SLOTS_SCREEN,
+    MSG_SLOT_OPTION,
+    MSG_NOTHING_TO_REORGANIZE,
+    MSG_SWAP_WITH_MENU,
+    MSG_SLOTS_SWAPPED,
+    MSG_ELIMINATED,
+    MSG_CARAVAN_EVIDENCE_SCREEN,
+    MSG_EVIDENCE_OPTION,
+    MSG_GHOST_INFO_SCREEN,
+    CATALOG_SIZE
+} catalogMessage;
+
+/// @brief Encode the id of the message and its parameters, the parameters must match the %d and %s of the text in the catalog.
+/// @param buffer 
+/// @param bufferSize 
+/// @param id 
+/// @param params 
+/// @return Return the length of the encoded message, or -1 if it doesn't fit in the buffer.
+int encodeCatalog(char* buffer, int bufferSize, catalogMessage id, va_list params);
+
+/// @brief Build the text of a message of the catalog, using the given parameters.
+/// @param text 
+/// @param textSize 
+/// @param id 
+/// @param ... The parameters of the text, in the same order of its placeholders.
+/// @return Return the status of the operation.
+bool buildCatalog(char* text, int textSize, catalogMessage id, ...);
+
+/// @brief Get the name of a zone to show.
+/// @param zone 
+/// @return Return the name of the zone.
+const char* getZoneName(int zone);
+
+/// @brief Get the name of an object or an evidence to show.
+/// @param object 
+/// @return Return the name of the object.
+const char* getObjectName(int object);
+
+/// @brief Build the text of an encoded message, using the catalog.
+/// @param payload 
+/// @param payloadLen 
+/// @param text 
+/// @param textSize 
+/// @return Return the status of the operation.
+bool formatCatalog(char* payload, int payloadLen, char* text, int textSize);
@@ -1,94 +1,319 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <pthread.h>
-#include "server.h"
-#include "utils.h"
-
-int startGame() {
-    // Load the server
-    if(!loadServer()) {
-        printf("\nError loading the server!");
-        return FALSE;
-    }
-
-    // Wait for the users to enter the server, and show the connected ones
-    int totalPlayers = createServerList();
-
-    // Start the threads to listen to all the data sent from all the clients
-    pthread_t pids[totalPlayers];
-    int clientsIds[totalPlayers];
-    for (int i = 0; i < totalPlayers; i++) {
-        clientsIds[i] = i;
-        if (pthread_create(pids + i, NULL, receiveData, (void*)(clientsIds + i))) {
-            printf("Error: failed creating the thread!\n");
-        }
-    }
-
-    // Set the game
-    set(totalPlayers + 1);
-
-    // Set the game master player
-    setPlayers(0, "");
-
-    // Request the player info to all the users
-    for (int i = 0; i < totalPlayers; i++) {
-        // Send the signal to send the player to the user
-        if (!sendData(i + 1, "SPI")) {
-            printf("\nError sending the game settings!");
-            return FALSE;
-        }
-        
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-
-        printf("\nWaiting to receive the player data...\n");
-
-        // Await the player info
-        char* playerData;
-        while((playerData = getDataReceived().data) == NULL);
-
-        // Set the player using the data received from the user
-        setPlayers(i + 1, playerData);
-
-        free(playerData);
-
-    }
-    
-    // Send the current game settings
-    char* gameSettings = (char*) malloc(2500);
-    char* tempInfo = showGameSettings();
-
-    // Regex to clear the terminal.
-    int currentLen = sprintf(gameSettings, "\e[1;1H\e[2J%s\x1b[1;33m\n\nWait the game master to start the game...\x1b[1;0m", tempInfo);
-    gameSettings = (char*) realloc(gameSettings, currentLen + 1);
-
-    for (int i = 0; i < totalPlayers; i++) {
-        if (!sendData(i + 1, gameSettings)) {
-            printf("\nError, while sending the game settings!");
-            return FALSE;
-        }
-    }
-
-    printf("%s", gameSettings);
-
-    free(tempInfo);
-    free(gameSettings);
-    
-    {
-        char confirm;
-        printf("\x1b[1;33m\n\nPress ENTER to continue: \x1b[1;0m");
-        scanf("%c", &confirm);
-    }
-
-    // Reset the data before the game
-    resetData();
-
-    // Play the game
-    playGame();
-
-    // Close the server connection
-    closeServer();
-
-    return TRUE;
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "server.h"
+#include "utils.h"
+
+typedef struct roomLobby {
+    serverRoom* room;
+    char* playersInfo[MAX_CLIENTS];
+    int infosCount;
+    bool failed;
+    pthread_mutex_t lock;
+    pthread_cond_t infoReceived;
+} roomLobby;
+
+typedef struct hostedRoom {
+    GameSession session;
+    roomLobby lobby;
+    int totalPlayers;
+} hostedRoom;
+
+/// @brief Agree on the protocol with the users of the room and collect their player info as soon as they join, called by the worker of the room.
+/// @param context The lobby of the room.
+/// @param clientIndex 
+/// @param message 
+/// @return Return FALSE for the messages that the game master's dialog has to read.
+static bool receiveLobbyMessage(void* context, int clientIndex, dataReceived message) {
+    roomLobby* lobby = (roomLobby*) context;
+
+    switch (message.opcode) {
+        case OP_HELLO:
+            // Ask the player info right away, so that every user writes it at the same time
+            if (!acceptHandshake(lobby -> room, clientIndex, message) || !sendMessage(lobby -> room, clientIndex, OP_SEND_PLAYER_INFO, NULL, 0)) {
+                printf("\nError during the handshake with the client %d!", clientIndex);
+
+                pthread_mutex_lock(&(lobby -> lock));
+                lobby -> failed = TRUE;
+                pthread_cond_broadcast(&(lobby -> infoReceived));
+                pthread_mutex_unlock(&(lobby -> lock));
+            }
+            flushData(lobby -> room, clientIndex);
+            return TRUE;
+
+        case OP_PLAYER_INFO:
+            pthread_mutex_lock(&(lobby -> lock));
+
+            // Keep only the first info sent by the user
+            if (lobby -> playersInfo[clientIndex - 1] == NULL) {
+                lobby -> playersInfo[clientIndex - 1] = message.data;
+                lobby -> infosCount++;
+                pthread_cond_broadcast(&(lobby -> infoReceived));
+            } else {
+                releaseData(message.data);
+            }
+
+            pthread_mutex_unlock(&(lobby -> lock));
+            return TRUE;
+
+        default:
+            return FALSE;
+    }
+}
+
+/// @brief Let the lobby receive the messages of the users that join the room.
+/// @param lobby 
+/// @param room 
+static void openLobby(roomLobby* lobby, serverRoom* room) {
+    memset(lobby, 0, sizeof(roomLobby));
+    lobby -> room = room;
+    pthread_mutex_init(&(lobby -> lock), NULL);
+    pthread_cond_init(&(lobby -> infoReceived), NULL);
+
+    setInputHandler(room, receiveLobbyMessage, lobby);
+
+    return;
+}
+
+/// @brief Stop the lobby, discarding the player info that hasn't been used.
+/// @param lobby 
+static void closeLobby(roomLobby* lobby) {
+    setInputHandler(lobby -> room, NULL, NULL);
+
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (lobby -> playersInfo[i] != NULL) {
+            releaseData(lobby -> playersInfo[i]);
+            lobby -> playersInfo[i] = NULL;
+        }
+    }
+
+    pthread_cond_destroy(&(lobby -> infoReceived));
+    pthread_mutex_destroy(&(lobby -> lock));
+
+    return;
+}
+
+/// @brief Wait the player info of all the users, then set their players.
+/// @param session 
+/// @param lobby 
+/// @param totalPlayers 
+/// @return Return the status of the operation.
+static bool collectPlayers(GameSession* session, roomLobby* lobby, int totalPlayers) {
+    pthread_mutex_lock(&(lobby -> lock));
+
+    // The users have been asked all together, so this waits only the slowest one
+    while ((lobby -> infosCount < totalPlayers) && !(lobby -> failed)) {
+        pthread_cond_wait(&(lobby -> infoReceived), &(lobby -> lock));
+    }
+
+    bool failed = lobby -> failed;
+
+    pthread_mutex_unlock(&(lobby -> lock));
+
+    if (failed) {
+        closeLobby(lobby);
+        return FALSE;
+    }
+
+    // Set the players using the data received from the users
+    for (int i = 0; i < totalPlayers; i++) {
+        setPlayers(session, i + 1, lobby -> playersInfo[i]);
+    }
+
+    closeLobby(lobby);
+
+    return TRUE;
+}
+
+/// @brief Send the game settings to the players, and wait that the game master starts the game.
+/// @param session 
+/// @return Return the status of the operation.
+static bool announceSettings(GameSession* session) {
+    char* gameSettings = (char*) malloc(2500);
+    char* tempInfo = showGameSettings(session);
+
+    // Regex to clear the terminal.
+    int currentLen = sprintf(gameSettings, "\e[1;1H\e[2J%s\x1b[1;33m\n\nWait the game master to start the game...\x1b[1;0m", tempInfo);
+    gameSettings = (char*) realloc(gameSettings, currentLen + 1);
+
+    // The game master is the first player, he is excluded only when he plays from a client
+    if (!broadcastData(session -> room, gameSettings, session -> firstPlayer)) {
+        printf("\nError, while sending the game settings!");
+        free(tempInfo);
+        free(gameSettings);
+        return FALSE;
+    }
+    flushAllData(session -> room);
+
+    free(gameSettings);
+
+    bool started = confirmGameSettings(session, tempInfo);
+
+    free(tempInfo);
+
+    return started;
+}
+
+int startGame(int backlog) {
+    // Load the server
+    if(!loadServer(backlog)) {
+        printf("\nError loading the server!");
+        return FALSE;
+    }
+
+    // Start the workers that accept the users and listen to all the data sent from all the clients
+    if (!startReceiving()) {
+        printf("Error: failed creating the thread!\n");
+        return FALSE;
+    }
+
+    // Create the session of the game, with the room of its clients
+    GameSession session = {0};
+    roomLobby lobby;
+    session.room = createRoom();
+    openLobby(&lobby, session.room);
+
+    if (!watchRoom(session.room)) {
+        printf("Error: failed listening the clients!\n");
+        return FALSE;
+    }
+
+    // Wait for the users to enter the server, and show the connected ones, while they write their player info
+    int totalPlayers = createServerList(session.room);
+    refuseLateClients();
+
+    // Set the game
+    if (!set(&session, totalPlayers + 1)) {
+        closeLobby(&lobby);
+        closeGame(&session);
+        closeRoom(session.room);
+        closeServer();
+        free(session.room);
+        return FALSE;
+    }
+
+    // Set the game master player
+    setPlayers(&session, 0, "");
+
+    // Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+
+    printf("\nWaiting to receive the player data...\n");
+
+    // Set the players of all the users
+    if (!collectPlayers(&session, &lobby, totalPlayers)) {
+        return FALSE;
+    }
+    
+    // Send the current game settings
+    if (!announceSettings(&session)) {
+        return FALSE;
+    }
+
+    // Reset the data before the game
+    resetData(&session);
+
+    // Play the game
+    playGame(&session);
+
+    // Close the server connection
+    closeRoom(session.room);
+    closeServer();
+    free(session.room);
+
+    return TRUE;
+}
+
+/// @brief Set the game of a room, then play it, on its own thread so the server keeps opening rooms.
+/// @param vargp The room to host.
+static void* hostRoom(void* vargp) {
+    hostedRoom* hosted = (hostedRoom*) vargp;
+    GameSession* session = &(hosted -> session);
+    bool ready = FALSE;
+
+    // Set the game while the other players join and write their player info
+    if (set(session, hosted -> totalPlayers + 1)) {
+        if (hosted -> totalPlayers > 1) {
+            sendData(session -> room, 1, "\e[1;1H\e[2J\nWaiting the other players to join the room...\n");
+            flushData(session -> room, 1);
+        }
+
+        ready = waitClients(session -> room, hosted -> totalPlayers) && collectPlayers(session, &(hosted -> lobby), hosted -> totalPlayers) && announceSettings(session);
+    } else {
+        closeLobby(&(hosted -> lobby));
+    }
+
+    if (ready) {
+        // Reset the data before the game
+        resetData(session);
+
+        // Play the game
+        playGame(session);
+    } else {
+        printf("\nThe room has been closed before starting the game.\n");
+        closeGame(session);
+    }
+
+    closeRoom(session -> room);
+    free(session -> room);
+    free(hosted);
+
+    return NULL;
+}
+
+int startDedicatedServer(int backlog) {
+    // Load the server
+    if (!loadServer(backlog)) {
+        printf("\nError loading the server!");
+        return FALSE;
+    }
+
+    // Start the workers that listen to all the data sent from all the clients
+    if (!startReceiving()) {
+        printf("Error: failed creating the thread!\n");
+        return FALSE;
+    }
+
+    printf("\nDedicated server started, waiting the game masters...\n");
+
+    // Open a room at a time, till the server is killed
+    while (TRUE) {
+        hostedRoom* hosted = (hostedRoom*) calloc(1, sizeof(hostedRoom));
+
+        // Without a game master in the terminal, the players start from the first client
+        GameSession* session = &(hosted -> session);
+        session -> room = createRoom();
+        session -> firstPlayer = 1;
+        openLobby(&(hosted -> lobby), session -> room);
+
+        // The first user that joins the room is the game master
+        if (!watchRoom(session -> room)) {
+            return FALSE;
+        }
+        openSeats(session -> room, 1);
+        waitClients(session -> room, 1);
+
+        printf("\nA game master has opened a room.\n");
+
+        // The players that connect now join this room, the next game master waits them to be seated
+        if ((hosted -> totalPlayers = choosePlayersCount(session)) > 1) {
+            openSeats(session -> room, hosted -> totalPlayers - 1);
+        }
+
+        pthread_t thread;
+        if ((hosted -> totalPlayers == 0) || pthread_create(&thread, NULL, hostRoom, hosted)) {
+            printf("\nThe room has been closed before starting the game.\n");
+            closeLobby(&(hosted -> lobby));
+            closeGame(session);
+            closeRoom(session -> room);
+            free(session -> room);
+            free(hosted);
+            continue;
+        }
+
+        pthread_detach(thread);
+    }
+
+    return TRUE;
+}
@@ -1,4 +1,12 @@
-
-/// @brief Start the game as game master.
-/// @return Return the status of the operation.
-int startGame();
+
+#define DEFAULT_BACKLOG 1024
+
+/// @brief Start the game as game master.
+/// @param backlog 
+/// @return Return the status of the operation.
+int startGame(int backlog);
+
+/// @brief Start the server without a game master in the terminal, every player joins from a client and the first one of each room sets the game.
+/// @param backlog 
+/// @return Return the status of the operation.
+int startDedicatedServer(int backlog);
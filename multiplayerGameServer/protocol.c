@@ -0,0 +1,48 @@
+#include <string.h>
+#include <arpa/inet.h>
+#include "protocol.h"
+
+void encodeHeader(char* buffer, messageHeader header) {
+    uint16_t flags = htons(header.flags);
+    uint32_t length = htonl(header.length);
+
+    buffer[0] = header.version;
+    buffer[1] = header.opcode;
+    memcpy(buffer + 2, &flags, sizeof(flags));
+    memcpy(buffer + 4, &length, sizeof(length));
+
+    return;
+}
+
+messageHeader decodeHeader(char* buffer) {
+    messageHeader header;
+    uint16_t flags;
+    uint32_t length;
+
+    memcpy(&flags, buffer + 2, sizeof(flags));
+    memcpy(&length, buffer + 4, sizeof(length));
+
+    header.version = (uint8_t) buffer[0];
+    header.opcode = (uint8_t) buffer[1];
+    header.flags = ntohs(flags);
+    header.length = ntohl(length);
+
+    return header;
+}
+
+void encodeStateEntry(char* buffer, uint8_t field, uint16_t value) {
+    value = htons(value);
+
+    buffer[0] = field;
+    memcpy(buffer + 1, &value, sizeof(value));
+
+    return;
+}
+
+void decodeStateEntry(char* buffer, uint8_t* field, uint16_t* value) {
+    *field = (uint8_t) buffer[0];
+    memcpy(value, buffer + 1, sizeof(*value));
+    *value = ntohs(*value);
+
+    return;
+}
@@ -0,0 +1,89 @@
+//NOTE: This file contains the format of the messages exchanged between the server and the clients.
+
+#pragma once
+
+#ifndef _PROTOCOL_H
+#define _PROTOCOL_H
+#endif
+
+#include <stdint.h>
+
+// Versions of the protocol that can be spoken, the highest common one is chosen with the handshake
+#define PROTOCOL_VERSION 3
+#define MIN_PROTOCOL_VERSION 3
+
+#define HEADER_SIZE 8
+#define MAX_MESSAGE_SIZE 2500
+
+// Every field of the game state is sent as its index followed by its value
+#define STATE_ENTRY_SIZE 3
+
+typedef enum protocolOpcode {
+    OP_HELLO,
+    OP_TEXT,
+    OP_SEND_PLAYER_INFO,
+    OP_PLAYER_INFO,
+    OP_NOT_YOUR_TURN,
+    OP_YOUR_TURN,
+    OP_USER_INPUT,
+    OP_INPUT,
+    OP_TURN_TERMINATED,
+    OP_TERMINATE_GAME,
+    OP_CATALOG,
+    OP_STATE,
+    OP_SCREEN,
+    OPCODES_COUNT
+} protocolOpcode;
+
+// A state message with STATE_SNAPSHOT contains all the fields, otherwise only the ones that have changed
+typedef enum protocolFlags {NO_FLAGS = 0, STATE_SNAPSHOT = 1} protocolFlags;
+
+// Fields of the game state known by the player, the backpack and the caravan evidence take one field per slot
+typedef enum stateField {
+    STATE_ROUND,
+    STATE_TURN,
+    STATE_MENTAL_HEALTH,
+    STATE_POSITION,
+    STATE_ZONE_EVIDENCE,
+    STATE_ZONE_OBJECT,
+    STATE_NEXT_ZONE,
+    STATE_USE_ADVICES,
+    STATE_SALT_PROTECTION,
+    STATE_GHOST_POSITION,
+    STATE_GHOST_APPEARANCE,
+    STATE_BACKPACK,
+    STATE_CARAVAN_EVIDENCE = STATE_BACKPACK + 4,
+    STATE_FIELDS_COUNT = STATE_CARAVAN_EVIDENCE + 3
+} stateField;
+
+// Screens that the client renders from the game state
+typedef enum gameScreen {SCREEN_PLAYER_INFO, SCREEN_ZONE_INFO, SCREEN_CARAVAN_EVIDENCE, SCREEN_GHOST_INFO, SCREENS_COUNT} gameScreen;
+
+typedef struct messageHeader {
+    uint8_t version;
+    uint8_t opcode;
+    uint16_t flags;
+    uint32_t length;
+} messageHeader;
+
+/// @brief Write the header at the start of the buffer, in network byte order.
+/// @param buffer 
+/// @param header 
+void encodeHeader(char* buffer, messageHeader header);
+
+/// @brief Read the header from the start of the buffer.
+/// @param buffer 
+/// @return Return the header decoded.
+messageHeader decodeHeader(char* buffer);
+
+/// @brief Write a field of the game state at the start of the buffer.
+/// @param buffer 
+/// @param field 
+/// @param value 
+void encodeStateEntry(char* buffer, uint8_t field, uint16_t value);
+
+/// @brief Read a field of the game state from the start of the buffer.
+/// @param buffer 
+/// @param field 
+/// @param value 
+void decodeStateEntry(char* buffer, uint8_t* field, uint16_t* value);
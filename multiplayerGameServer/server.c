@@ -1,271 +1,1265 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/socket.h>
-#include <arpa/inet.h>
-#include <pthread.h>
-#include <sys/ioctl.h>
-#include <net/if.h>
-#include "server.h"
-#include "utils.h"
-
-typedef struct sockaddr_in sockaddr_in;
-typedef struct ifreq ifreq;
-
-/* -------------------- GLOBAL VARIABLES ----------------------------- */
-
-static int server_socket;
-static int clients_sockets[3];
-static sockaddr_in server_addr;
-static char* ip_addrs[3];
-static int clientsCount = 0;
-static utilsStatus searchConnectionsStatus = SEARCHING;
-static dataReceived* firstDataCollected = NULL;
-static dataReceived* lastDataCollected = NULL;
-static int threadState = ACTIVE;
-
-/* ------------------------------------------------------------------- */
-
-/// @brief Initialize the server.
-/// @param server 
-/// @param port 
-/// @param backlog 
-/// @return Return the status of the initialization.
-static bool initServer(sockaddr_in server, u_short port, int backlog) {
-	// Create a socket and check if fails creating it
-	if ((server_socket = socket(AF_INET, SOCK_STREAM, 0)) == INVALID_SOCKET) {
-		printf("Could not create socket!\n");
-		return FALSE;
-	}
-
-	// Set the server info (family, address, port)
-	server.sin_family = AF_INET;
-	server.sin_addr.s_addr = htonl(INADDR_ANY);
-	server.sin_port = htons(port);
-	
-	// Bind the socket and check if fails binding it
-	if (bind(server_socket, (struct sockaddr*) &server, sizeof(server)) < 0) {
-		printf("\nBind failed with error code!\n");
-		return FALSE;
-	}
-
-	// Listen to incoming connections, with backlog (queue) limit of n connections
-	listen(server_socket, backlog);
-
-	return TRUE;
-}
-
-/// @brief Ask the user if he wants to end the search of players.
-static void askToClose() {
-	char confirm;
-	printf("\n\nDo you want to end the search? (Y/N): ");
-	scanf("%c", &confirm);
-
-	{	
-		// Clean the stdin
-		char c;
-		while((c = getc(stdin)) != EOF) {
-			if(c == '\n') {
-				break;          
-			}
-		}  
-	}
-
-	if (confirm == 'Y') {
-		searchConnectionsStatus = END;
-	} else if (confirm != 'N') {
-		return askToClose();
-	}
-
-	return;
-}
-
-bool sendData(int clientIndex, char* message) {
-	clientIndex--;
-	char* temp = (char*) calloc(2500, 1);
-
-	// Copy the message in a array with fixed length
-	sprintf(temp, "%s", message);
-
-	// Send the message
-	if (send(clients_sockets[clientIndex], temp, 2500, 0) < 0) {
-		free(temp);
-		printf("\nFailed sending the message to the client %d!\n", clientIndex + 1);
-		return FALSE;
-	}
-
-	free(temp);
-
-	return TRUE;
-}
-
-int getDataReceivedLen() {
-	dataReceived* scan = firstDataCollected;
-	int dataCollectedNum = 0;
-
-	// Scan all the element in the list and count them
-	while (scan != NULL) {
-		scan = scan -> next;
-		dataCollectedNum++;
-	}
-
-	return dataCollectedNum;
-}
-
-dataReceived getDataReceived() {
-	// Check if there's something to retrive
-	if (firstDataCollected == NULL) {
-		// Return the data requested
-		dataReceived dataRequested = {NULL, 0, -1};
-		return dataRequested;
-	}
-
-	// Get the data from the element
-	char* dataContainer = firstDataCollected -> data;
-	int dataLen = firstDataCollected -> length;
-	int clientId = firstDataCollected -> clientId;
-
-	// If the first element is the last element reset both
-	if (firstDataCollected == lastDataCollected) {
-		free(firstDataCollected);
-		firstDataCollected = NULL;
-		lastDataCollected = NULL;
-		// Return the data requested
-		dataReceived dataRequested = {dataContainer, dataLen, clientId};
-		return dataRequested;
-	}
-
-	// Copy the address of the first address
-	dataReceived* temp = firstDataCollected;
-
-	// Make the second element the first
-	firstDataCollected = firstDataCollected -> next;
-
-    // Deallocate the first element
-    free(temp);
-
-	// Return the data requested
-	dataReceived dataRequested = {dataContainer, dataLen, clientId};
-	return dataRequested;
-}
-
-static void saveDataReceived(char* dataRecv, int dataLen, int clientId) {
-	// Create a new element
-	dataReceived* newData = (dataReceived*) malloc(sizeof(dataReceived));
-
-	// Set the len of the message
-	newData -> length = dataLen + 1;
-
-	// Set the given string in the data collection
-	newData -> data = dataRecv; 
-
-	newData -> clientId = clientId;
-
-	// Set the next pointer as the last element
-	newData -> next = NULL;
-
-	// If the first element hasn't been created, create it
-	if (firstDataCollected == NULL) {
-		// Set the first element and the last element
-		firstDataCollected = newData;
-
-		// Set the last element equal to the first element as the list has only one element
-		lastDataCollected = firstDataCollected;
-
-		// Set the last element as the next one
-		firstDataCollected -> next = lastDataCollected;
-		
-		return;
-	}
-
-	// The old last element points to the new
-	lastDataCollected -> next = newData;
-
-	// Set the last element as this new element
-	lastDataCollected = newData;
-
-	return;
-}
-
-void* receiveData(void* vargp) {
-	// Store the value argument passed to this thread
-    int clientId = *(int*) vargp;
-
-	// Set the exit for the recursion
-	if (!threadState) {
-		return NULL;
-	}
-
-	int recv_size;
-	char* response = (char*) calloc(2500, 1);
-
-	if ((recv_size = recv(clients_sockets[clientId], response, 2500, 0)) == INVALID_RESPONSE) {
-		printf("\nFailed receiving the data from the client %d!\n", clientId + 1);
-		pthread_exit(NULL);
-		return receiveData(vargp);
-	} else {	
-		response = (char*) realloc(response, strlen(response) + 1);
-
-		// Save the data received
-		saveDataReceived(response, strlen(response), clientId);
-
-		return receiveData(vargp);
-	}
-	return receiveData(vargp);
-}
-
-int loadServer() {
-	// Initialize the server
-	if (!initServer(server_addr, 8080, 3)) {
-		printf("\nError: failed initializing the server!");
-		return FALSE;
-	}
-
-	return TRUE;
-
-} 
-
-int createServerList() {
-	int client;
-	sockaddr_in client_addr;
-	int c = sizeof(client_addr);
-
-	// Regex to clear the terminal.
-    printf("\e[1;1H\e[2J");
-	printf("\nWaiting the first user to connect...\n");
-	
-	// Wait till the number of the user connected is reached
-	do {	
-		// Check if the connection is made by an invalid socket.
-		while ((client = accept(server_socket, (struct sockaddr*) &client_addr, (socklen_t*) &c)) != INVALID_SOCKET) {
-			// Add the client to the list
-			clients_sockets[clientsCount] = client;
-
-			// Add the new user to the list
-			ip_addrs[clientsCount] = inet_ntoa(client_addr.sin_addr);
-			clientsCount++;
-			break;
-		}
-
-		// Regex to clear the terminal.
-		printf("\e[1;1H\e[2J");
-
-		printf("\n-------------------- USERS CONNECTED --------------------\n");
-
-		// Print the users currently connected
-		for (int i = 0; i < clientsCount; i++) {
-			printf("\n%d) Ip: %s ;", i + 1, ip_addrs[i]);
-		}
-
-		askToClose();
-
-	} while ((clientsCount < 3) && (searchConnectionsStatus != END));
-
-	return clientsCount;
-}
-
-void closeServer() {
-	printf("\nClosing the server!");
-	close(server_socket);
-	return;
-}
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <net/if.h>
+#include "server.h"
+#include "utils.h"
+#include "pool.h"
+
+#define MAX_EVENTS 8
+#define POOL_BLOCKS 64
+#define MAX_BATCH_MESSAGES 64
+#define HANDSHAKE_TIMEOUT 5000
+#define MAX_SHARDS 64
+#define ACCEPT_BATCH 64
+#define TABLE_INITIAL_CAPACITY 64
+
+// Set to FALSE to let the scheduler move the workers between the cores
+#define PIN_SHARDS TRUE
+
+typedef struct sockaddr_in sockaddr_in;
+typedef struct ifreq ifreq;
+typedef struct epoll_event epoll_event;
+
+typedef struct iovec iovec;
+typedef struct msghdr msghdr;
+
+typedef struct outboundMessage {
+	int references;
+	int length;
+	char data[];
+} outboundMessage;
+
+typedef struct outputBatch {
+	outboundMessage* messages[MAX_BATCH_MESSAGES];
+	int messagesCount;
+} outputBatch;
+
+typedef struct clientInbox {
+	dataReceived* firstDataCollected;
+	dataReceived* lastDataCollected;
+	pthread_mutex_t lock;
+	pthread_cond_t dataAvailable;
+} clientInbox;
+
+typedef struct reactorShard {
+	int shardId;
+	int epoll_fd;
+	int wakeup_fd;
+	int roomsCount;
+	pthread_t thread;
+} reactorShard;
+
+typedef struct roomClient {
+	serverRoom* room;
+	int socket;
+	int connectionId;
+	int clientId;
+	char ipAddress[INET_ADDRSTRLEN];
+	clientInbox inbox;
+	outputBatch* batch;
+	char* receiveBuffer;
+	int receivedBytes;
+	struct roomClient* nextPending;
+} roomClient;
+
+typedef struct connectionTable {
+	roomClient** connections;
+	int* freeSlots;
+	int freeSlotsCount;
+	int usedSlots;
+	int capacity;
+	int openConnections;
+	roomClient* firstPending;
+	roomClient* lastPending;
+	serverRoom* firstWaiting;
+	serverRoom* lastWaiting;
+	bool refusing;
+	pthread_mutex_t lock;
+	pthread_cond_t pendingAvailable;
+} connectionTable;
+
+struct serverRoom {
+	reactorShard* shard;
+	roomClient** clients;
+	int clientsCount;
+	int clientsCapacity;
+	int freeSeats;
+	struct serverRoom* nextWaiting;
+	pthread_cond_t clientJoined;
+	utilsStatus searchConnectionsStatus;
+	pthread_mutex_t handlerLock;
+	inputHandler handler;
+	void* handlerContext;
+};
+
+/* -------------------- GLOBAL VARIABLES ----------------------------- */
+
+static int server_socket;
+static sockaddr_in server_addr;
+static memoryPool messagesPool;
+static memoryPool nodesPool;
+static memoryPool connectionsPool;
+static memoryPool buffersPool;
+static memoryPool batchesPool;
+static connectionTable table = {.lock = PTHREAD_MUTEX_INITIALIZER, .pendingAvailable = PTHREAD_COND_INITIALIZER};
+static int threadState = ACTIVE;
+static reactorShard shards[MAX_SHARDS];
+static int shardsCount = 0;
+static pthread_mutex_t shardsLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ------------------------------------------------------------------- */
+
+/// @brief Initialize the server.
+/// @param server 
+/// @param port 
+/// @param backlog 
+/// @return Return the status of the initialization.
+static bool initServer(sockaddr_in server, unsigned short port, int backlog) {
+	// Create a socket and check if fails creating it
+	if ((server_socket = socket(AF_INET, SOCK_STREAM, 0)) == INVALID_SOCKET) {
+		printf("Could not create socket!\n");
+		return FALSE;
+	}
+
+	// Let the server restart while the connections of the previous run are still closing
+	{
+		int reuse = 1;
+		setsockopt(server_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+	}
+
+	// Set the server info (family, address, port)
+	server.sin_family = AF_INET;
+	server.sin_addr.s_addr = htonl(INADDR_ANY);
+	server.sin_port = htons(port);
+	
+	// Bind the socket and check if fails binding it
+	if (bind(server_socket, (struct sockaddr*) &server, sizeof(server)) < 0) {
+		printf("\nBind failed with error code!\n");
+		return FALSE;
+	}
+
+	// Listen to incoming connections, with backlog (queue) limit of n connections
+	if (listen(server_socket, backlog) < 0) {
+		printf("\nListen failed!\n");
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/// @brief Ask the user if he wants to end the search of players.
+/// @param room
+static void askToClose(serverRoom* room) {
+	char confirm;
+	printf("\n\nDo you want to end the search? (Y/N): ");
+	scanf("%c", &confirm);
+
+	{	
+		// Clean the stdin
+		char c;
+		while((c = getc(stdin)) != EOF) {
+			if(c == '\n') {
+				break;          
+			}
+		}  
+	}
+
+	if (confirm == 'Y') {
+		room -> searchConnectionsStatus = END;
+	} else if (confirm != 'N') {
+		return askToClose(room);
+	}
+
+	return;
+}
+
+/// @brief Send all the given buffers with as few system calls as possible, even if the socket accepts only a part of them at a time.
+/// @param socket
+/// @param buffers
+/// @param buffersCount
+/// @return Return the status of the operation.
+static bool sendAll(int socket, iovec* buffers, int buffersCount) {
+	while (buffersCount > 0) {
+		msghdr header = {0};
+		header.msg_iov = buffers;
+		header.msg_iovlen = buffersCount;
+
+		ssize_t sent = sendmsg(socket, &header, MSG_NOSIGNAL);
+
+		if (sent == INVALID_RESPONSE) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return FALSE;
+		}
+
+		// Skip the buffers that have been completely sent
+		while ((buffersCount > 0) && ((size_t) sent >= buffers -> iov_len)) {
+			sent -= buffers -> iov_len;
+			buffers++;
+			buffersCount--;
+		}
+
+		// Send the rest of the buffer that has been partially sent
+		if (buffersCount > 0) {
+			buffers -> iov_base = (char*) buffers -> iov_base + sent;
+			buffers -> iov_len -= sent;
+		}
+	}
+
+	return TRUE;
+}
+
+/// @brief Drop a reference to the message, and give it back to the pool when nobody uses it anymore.
+/// @param message
+static void releaseMessage(outboundMessage* message) {
+	if (__atomic_sub_fetch(&(message -> references), 1, __ATOMIC_ACQ_REL) == 0) {
+		poolFree(&messagesPool, message);
+	}
+
+	return;
+}
+
+bool flushData(serverRoom* room, int clientIndex) {
+	roomClient* client = room -> clients[clientIndex - 1];
+	outputBatch* batch = client -> batch;
+	iovec buffers[MAX_BATCH_MESSAGES];
+	bool status = TRUE;
+
+	// Check if there's something to send
+	if (batch == NULL) {
+		return TRUE;
+	}
+
+	for (int i = 0; i < batch -> messagesCount; i++) {
+		buffers[i].iov_base = batch -> messages[i] -> data;
+		buffers[i].iov_len = batch -> messages[i] -> length;
+	}
+
+	// Send all the messages of the batch at once
+	if ((client -> socket == INVALID_SOCKET) || !sendAll(client -> socket, buffers, batch -> messagesCount)) {
+		printf("\nFailed sending the message to the client %d!\n", clientIndex);
+		status = FALSE;
+	}
+
+	for (int i = 0; i < batch -> messagesCount; i++) {
+		releaseMessage(batch -> messages[i]);
+	}
+
+	// Idle clients don't keep a batch
+	poolFree(&batchesPool, batch);
+	client -> batch = NULL;
+
+	return status;
+}
+
+bool flushAllData(serverRoom* room) {
+	bool status = TRUE;
+
+	for (int i = 0; i < room -> clientsCount; i++) {
+		if (!flushData(room, i + 1)) {
+			status = FALSE;
+		}
+	}
+
+	return status;
+}
+
+/// @brief Frame the payload into a buffer from the pool, that can be shared between many batches.
+/// @param opcode
+/// @param flags
+/// @param payload
+/// @param payloadLen
+/// @return Return the encoded message, or NULL if it doesn't fit in a frame.
+static outboundMessage* encodeMessage(protocolOpcode opcode, protocolFlags flags, char* payload, int payloadLen) {
+	// Check that the payload fits in a single frame
+	if (payloadLen > MAX_MESSAGE_SIZE) {
+		printf("\nThe message is too long to be sent!\n");
+		return NULL;
+	}
+
+	outboundMessage* temp = (outboundMessage*) poolAlloc(&messagesPool, sizeof(outboundMessage) + HEADER_SIZE + payloadLen);
+	temp -> references = 0;
+	temp -> length = HEADER_SIZE + payloadLen;
+
+	// Prepend the header of the message
+	messageHeader header = {PROTOCOL_VERSION, opcode, flags, payloadLen};
+	encodeHeader(temp -> data, header);
+	if (payloadLen > 0) {
+		memcpy(temp -> data + HEADER_SIZE, payload, payloadLen);
+	}
+
+	return temp;
+}
+
+/// @brief Add a reference of the message to the batch of the given client.
+/// @param room
+/// @param clientIndex
+/// @param message
+static void queueMessage(serverRoom* room, int clientIndex, outboundMessage* message) {
+	roomClient* client = room -> clients[clientIndex - 1];
+
+	// Make space in the batch if it's full
+	if ((client -> batch != NULL) && (client -> batch -> messagesCount == MAX_BATCH_MESSAGES)) {
+		flushData(room, clientIndex);
+	}
+
+	// Take a batch only when there's something to send
+	if (client -> batch == NULL) {
+		client -> batch = (outputBatch*) poolAlloc(&batchesPool, sizeof(outputBatch));
+		client -> batch -> messagesCount = 0;
+	}
+
+	outputBatch* batch = client -> batch;
+
+	// The message will be sent with the rest of the batch
+	__atomic_add_fetch(&(message -> references), 1, __ATOMIC_RELAXED);
+	batch -> messages[batch -> messagesCount] = message;
+	batch -> messagesCount++;
+
+	return;
+}
+
+bool sendMessage(serverRoom* room, int clientIndex, protocolOpcode opcode, char* payload, int payloadLen) {
+	return sendFlaggedMessage(room, clientIndex, opcode, NO_FLAGS, payload, payloadLen);
+}
+
+bool sendFlaggedMessage(serverRoom* room, int clientIndex, protocolOpcode opcode, protocolFlags flags, char* payload, int payloadLen) {
+	outboundMessage* temp = encodeMessage(opcode, flags, payload, payloadLen);
+
+	if (temp == NULL) {
+		return FALSE;
+	}
+
+	queueMessage(room, clientIndex, temp);
+
+	return TRUE;
+}
+
+bool broadcastMessage(serverRoom* room, protocolOpcode opcode, char* payload, int payloadLen, int exceptIndex) {
+	outboundMessage* temp = encodeMessage(opcode, NO_FLAGS, payload, payloadLen);
+
+	if (temp == NULL) {
+		return FALSE;
+	}
+
+	// Hold a reference while queueing, so that a flush can't release the message too early
+	temp -> references = 1;
+
+	for (int i = 0; i < room -> clientsCount; i++) {
+		if ((i + 1) == exceptIndex) {
+			continue;
+		}
+
+		queueMessage(room, i + 1, temp);
+	}
+
+	releaseMessage(temp);
+
+	return TRUE;
+}
+
+bool sendData(serverRoom* room, int clientIndex, char* message) {
+	return sendMessage(room, clientIndex, OP_TEXT, message, strlen(message));
+}
+
+bool broadcastData(serverRoom* room, char* message, int exceptIndex) {
+	return broadcastMessage(room, OP_TEXT, message, strlen(message), exceptIndex);
+}
+
+bool sendCatalog(serverRoom* room, int clientIndex, catalogMessage id, ...) {
+	char payload[MAX_MESSAGE_SIZE];
+	va_list params;
+
+	va_start(params, id);
+	int payloadLen = encodeCatalog(payload, MAX_MESSAGE_SIZE, id, params);
+	va_end(params);
+
+	if (payloadLen == INVALID_RESPONSE) {
+		printf("\nThe parameters of the message %d are too long!\n", id);
+		return FALSE;
+	}
+
+	return sendMessage(room, clientIndex, OP_CATALOG, payload, payloadLen);
+}
+
+bool broadcastCatalog(serverRoom* room, catalogMessage id, int exceptIndex, ...) {
+	char payload[MAX_MESSAGE_SIZE];
+	va_list params;
+
+	va_start(params, exceptIndex);
+	int payloadLen = encodeCatalog(payload, MAX_MESSAGE_SIZE, id, params);
+	va_end(params);
+
+	if (payloadLen == INVALID_RESPONSE) {
+		printf("\nThe parameters of the message %d are too long!\n", id);
+		return FALSE;
+	}
+
+	return broadcastMessage(room, OP_CATALOG, payload, payloadLen, exceptIndex);
+}
+
+serverRoom* createRoom() {
+	serverRoom* room = (serverRoom*) calloc(1, sizeof(serverRoom));
+
+	pthread_cond_init(&(room -> clientJoined), NULL);
+	room -> searchConnectionsStatus = SEARCHING;
+	pthread_mutex_init(&(room -> handlerLock), NULL);
+
+	return room;
+}
+
+void setInputHandler(serverRoom* room, inputHandler handler, void* context) {
+	pthread_mutex_lock(&(room -> handlerLock));
+	room -> handler = handler;
+	room -> handlerContext = context;
+	pthread_mutex_unlock(&(room -> handlerLock));
+
+	// Discard what has been received before, the handler only gets the new messages
+	for (int i = 0; (handler != NULL) && (i < room -> clientsCount); i++) {
+		dataReceived oldData;
+		while ((oldData = getDataReceived(room, i + 1, 0)).data != NULL) {
+			releaseData(oldData.data);
+		}
+	}
+
+	return;
+}
+
+int getDataReceivedLen(serverRoom* room, int clientIndex) {
+	clientInbox* inbox = &(room -> clients[clientIndex - 1] -> inbox);
+	pthread_mutex_lock(&(inbox -> lock));
+
+	dataReceived* scan = inbox -> firstDataCollected;
+	int dataCollectedNum = 0;
+
+	// Scan all the element in the list and count them
+	while (scan != NULL) {
+		scan = scan -> next;
+		dataCollectedNum++;
+	}
+
+	pthread_mutex_unlock(&(inbox -> lock));
+
+	return dataCollectedNum;
+}
+
+dataReceived getDataReceived(serverRoom* room, int clientIndex, int timeout) {
+	clientInbox* inbox = &(room -> clients[clientIndex - 1] -> inbox);
+	struct timespec deadline;
+
+	// Compute when to stop waiting
+	if (timeout > 0) {
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += timeout / 1000;
+		deadline.tv_nsec += (timeout % 1000) * 1000000L;
+
+		if (deadline.tv_nsec >= 1000000000L) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+	}
+
+	pthread_mutex_lock(&(inbox -> lock));
+
+	// Sleep till the client sends something or the timeout expires
+	while ((inbox -> firstDataCollected == NULL) && (timeout != 0)) {
+		if (timeout == NO_TIMEOUT) {
+			pthread_cond_wait(&(inbox -> dataAvailable), &(inbox -> lock));
+		} else if (pthread_cond_timedwait(&(inbox -> dataAvailable), &(inbox -> lock), &deadline) == ETIMEDOUT) {
+			break;
+		}
+	}
+
+	// Check if there's something to retrive
+	if (inbox -> firstDataCollected == NULL) {
+		pthread_mutex_unlock(&(inbox -> lock));
+
+		// Return the data requested
+		dataReceived dataRequested = {NULL, 0, -1, OP_HELLO};
+		return dataRequested;
+	}
+
+	// Copy the address of the first address
+	dataReceived* temp = inbox -> firstDataCollected;
+
+	// Make the second element the first, if the first element is the last element reset both
+	inbox -> firstDataCollected = temp -> next;
+	if (inbox -> firstDataCollected == NULL) {
+		inbox -> lastDataCollected = NULL;
+	}
+
+	pthread_mutex_unlock(&(inbox -> lock));
+
+	// Return the data requested
+	dataReceived dataRequested = {temp -> data, temp -> length, temp -> clientId, temp -> opcode};
+
+	// Give back the element to the pool
+	poolFree(&nodesPool, temp);
+
+	return dataRequested;
+}
+
+void releaseData(char* data) {
+	poolFree(&messagesPool, data);
+	return;
+}
+
+bool negotiateProtocol(serverRoom* room, int clientIndex) {
+	// Wait the versions supported by the client
+	dataReceived hello = getDataReceived(room, clientIndex, HANDSHAKE_TIMEOUT);
+
+	if (hello.data == NULL) {
+		printf("\nThe client %d hasn't sent the handshake!\n", clientIndex);
+		return FALSE;
+	}
+
+	return acceptHandshake(room, clientIndex, hello);
+}
+
+bool acceptHandshake(serverRoom* room, int clientIndex, dataReceived hello) {
+	char version = 0;
+
+	// Choose the highest version supported by both, the length counts also the string terminator
+	if ((hello.opcode == OP_HELLO) && (hello.length > 2)) {
+		int minVersion = hello.data[0] > MIN_PROTOCOL_VERSION ? hello.data[0] : MIN_PROTOCOL_VERSION;
+		int maxVersion = hello.data[1] < PROTOCOL_VERSION ? hello.data[1] : PROTOCOL_VERSION;
+
+		if (minVersion <= maxVersion) {
+			version = maxVersion;
+		}
+	}
+
+	releaseData(hello.data);
+
+	// Send the version chosen, 0 if there's none
+	sendMessage(room, clientIndex, OP_HELLO, &version, 1);
+	flushData(room, clientIndex);
+
+	if (version == 0) {
+		printf("\nThe client %d uses an unsupported version of the protocol!\n", clientIndex);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static void saveDataReceived(char* dataRecv, int dataLen, roomClient* client, protocolOpcode opcode) {
+	clientInbox* inbox = &(client -> inbox);
+	serverRoom* room = client -> room;
+
+	// Let the handler of the room process the message right away, on this worker
+	pthread_mutex_lock(&(room -> handlerLock));
+	if (room -> handler != NULL) {
+		dataReceived message = {dataRecv, dataLen + 1, client -> clientId, opcode, NULL};
+		if (room -> handler(room -> handlerContext, client -> clientId + 1, message)) {
+			pthread_mutex_unlock(&(room -> handlerLock));
+			return;
+		}
+	}
+	pthread_mutex_unlock(&(room -> handlerLock));
+
+	// Create a new element
+	dataReceived* newData = (dataReceived*) poolAlloc(&nodesPool, sizeof(dataReceived));
+
+	// Set the len of the message
+	newData -> length = dataLen + 1;
+
+	// Set the given string in the data collection
+	newData -> data = dataRecv; 
+
+	newData -> clientId = client -> clientId;
+
+	newData -> opcode = opcode;
+
+	// Set the next pointer as the last element
+	newData -> next = NULL;
+
+	pthread_mutex_lock(&(inbox -> lock));
+
+	// If the first element hasn't been created, create it, otherwise the old last element points to the new
+	if (inbox -> firstDataCollected == NULL) {
+		inbox -> firstDataCollected = newData;
+	} else {
+		inbox -> lastDataCollected -> next = newData;
+	}
+
+	// Set the last element as this new element
+	inbox -> lastDataCollected = newData;
+
+	// Wake up who is waiting for the data of this client
+	pthread_cond_signal(&(inbox -> dataAvailable));
+
+	pthread_mutex_unlock(&(inbox -> lock));
+
+	return;
+}
+
+/// @brief Remove the client from the event loop and close its socket.
+/// @param client
+static void dropClient(roomClient* client) {
+	printf("\nThe client %d has disconnected!\n", client -> clientId + 1);
+	epoll_ctl(client -> room -> shard -> epoll_fd, EPOLL_CTL_DEL, client -> socket, NULL);
+	close(client -> socket);
+	client -> socket = INVALID_SOCKET;
+	client -> receivedBytes = 0;
+
+	if (client -> receiveBuffer != NULL) {
+		poolFree(&buffersPool, client -> receiveBuffer);
+		client -> receiveBuffer = NULL;
+	}
+
+	return;
+}
+
+/// @brief Read all the bytes available from the client without blocking, and save every complete message.
+/// @param client
+static void readClient(roomClient* client) {
+	// Take a buffer only while the client is sending something
+	if (client -> receiveBuffer == NULL) {
+		client -> receiveBuffer = (char*) poolAlloc(&buffersPool, HEADER_SIZE + MAX_MESSAGE_SIZE);
+	}
+
+	char* buffer = client -> receiveBuffer;
+
+	while (TRUE) {
+		int recv_size = recv(client -> socket, buffer + client -> receivedBytes, (HEADER_SIZE + MAX_MESSAGE_SIZE) - client -> receivedBytes, MSG_DONTWAIT);
+
+		if (recv_size == INVALID_RESPONSE) {
+			// Stop when there's nothing else to read, keeping the buffer only for a message received in part
+			if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+				if (client -> receivedBytes == 0) {
+					poolFree(&buffersPool, client -> receiveBuffer);
+					client -> receiveBuffer = NULL;
+				}
+
+				return;
+			}
+
+			printf("\nFailed receiving the data from the client %d!\n", client -> clientId + 1);
+			dropClient(client);
+			return;
+		} else if (recv_size == 0) {
+			dropClient(client);
+			return;
+		}
+
+		client -> receivedBytes += recv_size;
+
+		// Save every message that has been completely received
+		while (client -> receivedBytes >= HEADER_SIZE) {
+			messageHeader header = decodeHeader(buffer);
+			int dataLen = header.length;
+
+			// Drop the clients that don't respect the protocol, only the handshake can be sent with a newer version
+			if ((header.length > MAX_MESSAGE_SIZE) || (header.opcode >= OPCODES_COUNT) || (header.version < MIN_PROTOCOL_VERSION) || ((header.version > PROTOCOL_VERSION) && (header.opcode != OP_HELLO))) {
+				printf("\nThe client %d has sent an invalid message!\n", client -> clientId + 1);
+				dropClient(client);
+				return;
+			}
+
+			// Wait till the whole message has been received
+			if (client -> receivedBytes < (HEADER_SIZE + dataLen)) {
+				break;
+			}
+
+			// Copy the message and save it
+			char* response = (char*) poolAlloc(&messagesPool, dataLen + 1);
+			memcpy(response, buffer + HEADER_SIZE, dataLen);
+			response[dataLen] = '\0';
+			saveDataReceived(response, dataLen, client, header.opcode);
+
+			// Move the bytes of the next message at the start of the buffer
+			client -> receivedBytes -= HEADER_SIZE + dataLen;
+			memmove(buffer, buffer + HEADER_SIZE + dataLen, client -> receivedBytes);
+		}
+	}
+}
+
+/// @brief Add a new connection to the table, reusing the slot of a closed one if there's any.
+/// @param socket 
+/// @param address 
+/// @return Return the connection.
+static roomClient* openConnection(int socket, sockaddr_in* address) {
+	roomClient* client = (roomClient*) poolAlloc(&connectionsPool, sizeof(roomClient));
+	pthread_condattr_t attributes;
+
+	memset(client, 0, sizeof(roomClient));
+	client -> socket = socket;
+	inet_ntop(AF_INET, &(address -> sin_addr), client -> ipAddress, INET_ADDRSTRLEN);
+
+	// Measure the timeouts with a clock that can't jump
+	pthread_condattr_init(&attributes);
+	pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+	pthread_mutex_init(&(client -> inbox.lock), NULL);
+	pthread_cond_init(&(client -> inbox.dataAvailable), &attributes);
+	pthread_condattr_destroy(&attributes);
+
+	pthread_mutex_lock(&(table.lock));
+
+	if (table.freeSlotsCount > 0) {
+		client -> connectionId = table.freeSlots[--table.freeSlotsCount];
+	} else {
+		// Double the table when it's full
+		if (table.usedSlots == table.capacity) {
+			table.capacity = (table.capacity == 0) ? TABLE_INITIAL_CAPACITY : table.capacity * 2;
+			table.connections = (roomClient**) realloc(table.connections, table.capacity * sizeof(roomClient*));
+			table.freeSlots = (int*) realloc(table.freeSlots, table.capacity * sizeof(int));
+		}
+
+		client -> connectionId = table.usedSlots++;
+	}
+
+	table.connections[client -> connectionId] = client;
+	table.openConnections++;
+
+	pthread_mutex_unlock(&(table.lock));
+
+	return client;
+}
+
+/// @brief Close the connection, and give back its slot and all its memory.
+/// @param client 
+static void closeConnection(roomClient* client) {
+	if (client -> socket != INVALID_SOCKET) {
+		close(client -> socket);
+	}
+
+	// Discard what hasn't been read or sent
+	dataReceived* scan = client -> inbox.firstDataCollected;
+	while (scan != NULL) {
+		dataReceived* next = scan -> next;
+		releaseData(scan -> data);
+		poolFree(&nodesPool, scan);
+		scan = next;
+	}
+
+	if (client -> batch != NULL) {
+		for (int i = 0; i < client -> batch -> messagesCount; i++) {
+			releaseMessage(client -> batch -> messages[i]);
+		}
+		poolFree(&batchesPool, client -> batch);
+	}
+
+	if (client -> receiveBuffer != NULL) {
+		poolFree(&buffersPool, client -> receiveBuffer);
+	}
+
+	pthread_mutex_destroy(&(client -> inbox.lock));
+	pthread_cond_destroy(&(client -> inbox.dataAvailable));
+
+	pthread_mutex_lock(&(table.lock));
+	table.connections[client -> connectionId] = NULL;
+	table.freeSlots[table.freeSlotsCount++] = client -> connectionId;
+	table.openConnections--;
+	pthread_mutex_unlock(&(table.lock));
+
+	poolFree(&connectionsPool, client);
+
+	return;
+}
+
+/// @brief Add the client to the room, must be called with the lock of the table.
+/// @param room 
+/// @param client 
+static void joinRoom(serverRoom* room, roomClient* client) {
+	// Make space in the room if it's full, the seats opened have already reserved it
+	if (room -> clientsCount == room -> clientsCapacity) {
+		room -> clientsCapacity = (room -> clientsCapacity == 0) ? MAX_CLIENTS : room -> clientsCapacity * 2;
+		room -> clients = (roomClient**) realloc(room -> clients, room -> clientsCapacity * sizeof(roomClient*));
+	}
+
+	// Add the client to the list
+	client -> room = room;
+	client -> clientId = room -> clientsCount;
+	client -> nextPending = NULL;
+	room -> clients[room -> clientsCount] = client;
+
+	// Listen to the client if the room has already a worker, otherwise it will be listened by watchRoom
+	if (room -> shard != NULL) {
+		epoll_event event;
+		event.events = EPOLLIN;
+		event.data.ptr = client;
+
+		// The client stays in the room as a disconnected one
+		if (epoll_ctl(room -> shard -> epoll_fd, EPOLL_CTL_ADD, client -> socket, &event) == INVALID_RESPONSE) {
+			printf("\nFailed listening the client %d!\n", room -> clientsCount + 1);
+			close(client -> socket);
+			client -> socket = INVALID_SOCKET;
+		}
+	}
+
+	room -> clientsCount++;
+
+	// Wake up who is waiting the users of the room
+	pthread_cond_broadcast(&(room -> clientJoined));
+
+	return;
+}
+
+/// @brief Add the client to a free seat of the room, must be called with the lock of the table.
+/// @param room 
+/// @param client 
+static void takeSeat(serverRoom* room, roomClient* client) {
+	joinRoom(room, client);
+	room -> freeSeats--;
+
+	// Remove the room from the waiting ones once it's full, it's always the first one
+	if (room -> freeSeats == 0) {
+		table.firstWaiting = room -> nextWaiting;
+		if (table.firstWaiting == NULL) {
+			table.lastWaiting = NULL;
+		}
+		room -> nextWaiting = NULL;
+	}
+
+	return;
+}
+
+/// @brief Accept the connections waiting in the backlog, a batch at a time so the other events of the worker aren't delayed, and queue them for the rooms.
+static void acceptConnections() {
+	sockaddr_in client_addr;
+	socklen_t c = sizeof(client_addr);
+
+	for (int i = 0; i < ACCEPT_BATCH; i++) {
+		int client = accept(server_socket, (struct sockaddr*) &client_addr, &c);
+
+		// Stop when the backlog is empty
+		if (client == INVALID_SOCKET) {
+			if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR) && (errno != ECONNABORTED)) {
+				printf("\nFailed accepting the connection!\n");
+			}
+
+			return;
+		}
+
+		// Refuse the connections made after the search of players has ended
+		pthread_mutex_lock(&(table.lock));
+		bool refusing = table.refusing;
+		pthread_mutex_unlock(&(table.lock));
+
+		if (refusing) {
+			close(client);
+			continue;
+		}
+
+		roomClient* connection = openConnection(client, &client_addr);
+
+		pthread_mutex_lock(&(table.lock));
+
+		// Give the connection to the first room with a free seat, otherwise keep it for acceptClient
+		if (table.firstWaiting != NULL) {
+			takeSeat(table.firstWaiting, connection);
+		} else {
+			if (table.lastPending == NULL) {
+				table.firstPending = connection;
+			} else {
+				table.lastPending -> nextPending = connection;
+			}
+			table.lastPending = connection;
+
+			pthread_cond_signal(&(table.pendingAvailable));
+		}
+
+		pthread_mutex_unlock(&(table.lock));
+	}
+
+	return;
+}
+
+/// @brief Run the event loop of a shard, that receives the data from all the clients of its rooms.
+/// @param vargp The shard to run.
+static void* receiveData(void* vargp) {
+	reactorShard* shard = (reactorShard*) vargp;
+	epoll_event events[MAX_EVENTS];
+
+	while (threadState) {
+		int eventsCount = epoll_wait(shard -> epoll_fd, events, MAX_EVENTS, -1);
+
+		if (eventsCount == INVALID_RESPONSE) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			printf("\nFailed waiting the data from the clients!\n");
+			break;
+		}
+
+		for (int i = 0; i < eventsCount; i++) {
+			void* source = events[i].data.ptr;
+
+			// The server is closing
+			if (source == &(shard -> wakeup_fd)) {
+				continue;
+			}
+
+			if (source == &server_socket) {
+				acceptConnections();
+				continue;
+			}
+
+			// Every client is registered with its own slot of the room
+			readClient((roomClient*) source);
+		}
+	}
+
+	return NULL;
+}
+
+/// @brief Create the event loop of the shard and start its worker, pinned to its core if requested.
+/// @param shard 
+/// @param shardId 
+/// @return Return the status of the operation.
+static bool startShard(reactorShard* shard, int shardId) {
+	epoll_event event;
+
+	shard -> shardId = shardId;
+	shard -> roomsCount = 0;
+
+	// Create the event loop and the descriptor used to wake it up
+	if (((shard -> epoll_fd = epoll_create1(0)) == INVALID_SOCKET) || ((shard -> wakeup_fd = eventfd(0, EFD_NONBLOCK)) == INVALID_SOCKET)) {
+		printf("\nFailed creating the event loop of the shard %d!\n", shardId);
+		return FALSE;
+	}
+
+	event.events = EPOLLIN;
+	event.data.ptr = &(shard -> wakeup_fd);
+	epoll_ctl(shard -> epoll_fd, EPOLL_CTL_ADD, shard -> wakeup_fd, &event);
+
+	if (pthread_create(&(shard -> thread), NULL, receiveData, shard)) {
+		printf("\nFailed starting the worker of the shard %d!\n", shardId);
+		return FALSE;
+	}
+
+	// Keep the worker on the same core, so its rooms stay in the same cache
+	if (PIN_SHARDS) {
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(shardId, &cpus);
+		pthread_setaffinity_np(shard -> thread, sizeof(cpu_set_t), &cpus);
+	}
+
+	return TRUE;
+}
+
+int startReceiving() {
+	epoll_event event;
+
+	// Preallocate the memory for the messages, so that the game doesn't need to allocate it every turn
+	initPool(&messagesPool, sizeof(outboundMessage) + HEADER_SIZE + MAX_MESSAGE_SIZE + 1, POOL_BLOCKS);
+	initPool(&nodesPool, sizeof(dataReceived), POOL_BLOCKS);
+	initPool(&connectionsPool, sizeof(roomClient), POOL_BLOCKS);
+	initPool(&buffersPool, HEADER_SIZE + MAX_MESSAGE_SIZE, POOL_BLOCKS);
+	initPool(&batchesPool, sizeof(outputBatch), POOL_BLOCKS);
+
+	// Start a worker for every core
+	int cores = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	cores = (cores < 1) ? 1 : ((cores > MAX_SHARDS) ? MAX_SHARDS : cores);
+
+	for (shardsCount = 0; shardsCount < cores; shardsCount++) {
+		if (!startShard(shards + shardsCount, shardsCount)) {
+			return FALSE;
+		}
+	}
+
+	// Listen to the server socket without blocking, the first worker accepts the connections
+	{
+		int nonBlocking = 1;
+		ioctl(server_socket, FIONBIO, &nonBlocking);
+	}
+
+	event.events = EPOLLIN;
+	event.data.ptr = &server_socket;
+	if (epoll_ctl(shards[0].epoll_fd, EPOLL_CTL_ADD, server_socket, &event) == INVALID_RESPONSE) {
+		printf("\nFailed listening the server socket!\n");
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+void refuseLateClients() {
+	pthread_mutex_lock(&(table.lock));
+
+	table.refusing = TRUE;
+
+	// Close the connections that no room has taken
+	roomClient* pending = table.firstPending;
+	table.firstPending = NULL;
+	table.lastPending = NULL;
+
+	pthread_mutex_unlock(&(table.lock));
+
+	while (pending != NULL) {
+		roomClient* next = pending -> nextPending;
+		closeConnection(pending);
+		pending = next;
+	}
+
+	return;
+}
+
+int watchRoom(serverRoom* room) {
+	epoll_event event;
+	event.events = EPOLLIN;
+
+	// Assign the room to the shard with less rooms
+	pthread_mutex_lock(&shardsLock);
+	room -> shard = shards;
+	for (int i = 1; i < shardsCount; i++) {
+		if (shards[i].roomsCount < room -> shard -> roomsCount) {
+			room -> shard = shards + i;
+		}
+	}
+	room -> shard -> roomsCount++;
+	pthread_mutex_unlock(&shardsLock);
+
+	// Listen to all the clients of the room
+	for (int i = 0; i < room -> clientsCount; i++) {
+		event.data.ptr = room -> clients[i];
+		if (epoll_ctl(room -> shard -> epoll_fd, EPOLL_CTL_ADD, room -> clients[i] -> socket, &event) == INVALID_RESPONSE) {
+			printf("\nFailed listening the client %d!\n", i + 1);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+int loadServer(int backlog) {
+	// Initialize the server
+	if (!initServer(server_addr, 8080, backlog)) {
+		printf("\nError: failed initializing the server!");
+		return FALSE;
+	}
+
+	return TRUE;
+
+} 
+
+int acceptClient(serverRoom* room) {
+	pthread_mutex_lock(&(table.lock));
+
+	// Wait the first worker to accept a connection
+	while ((table.firstPending == NULL) && threadState) {
+		pthread_cond_wait(&(table.pendingAvailable), &(table.lock));
+	}
+
+	// The server is closing
+	if (table.firstPending == NULL) {
+		pthread_mutex_unlock(&(table.lock));
+		return FALSE;
+	}
+
+	roomClient* client = table.firstPending;
+	table.firstPending = client -> nextPending;
+	if (table.firstPending == NULL) {
+		table.lastPending = NULL;
+	}
+
+	joinRoom(room, client);
+	int clientIndex = room -> clientsCount;
+
+	pthread_mutex_unlock(&(table.lock));
+
+	return clientIndex;
+}
+
+void openSeats(serverRoom* room, int seats) {
+	pthread_mutex_lock(&(table.lock));
+
+	// Reserve the space now, so the list doesn't move while the room is in use
+	int needed = room -> clientsCount + room -> freeSeats + seats;
+	if (needed > room -> clientsCapacity) {
+		room -> clientsCapacity = (needed > MAX_CLIENTS) ? needed : MAX_CLIENTS;
+		room -> clients = (roomClient**) realloc(room -> clients, room -> clientsCapacity * sizeof(roomClient*));
+	}
+
+	// Queue the room after the others that are waiting users
+	if ((room -> freeSeats == 0) && (seats > 0)) {
+		if (table.lastWaiting == NULL) {
+			table.firstWaiting = room;
+		} else {
+			table.lastWaiting -> nextWaiting = room;
+		}
+		table.lastWaiting = room;
+	}
+	room -> freeSeats += seats;
+
+	// Give the seats to the users already connected, as long as the room is the first one waiting
+	while ((room -> freeSeats > 0) && (table.firstWaiting == room) && (table.firstPending != NULL)) {
+		roomClient* client = table.firstPending;
+		table.firstPending = client -> nextPending;
+		if (table.firstPending == NULL) {
+			table.lastPending = NULL;
+		}
+
+		takeSeat(room, client);
+	}
+
+	pthread_mutex_unlock(&(table.lock));
+
+	return;
+}
+
+void closeSeats(serverRoom* room) {
+	pthread_mutex_lock(&(table.lock));
+
+	// Remove the room from the waiting ones
+	if (room -> freeSeats > 0) {
+		serverRoom** scan = &(table.firstWaiting);
+		serverRoom* previous = NULL;
+
+		while (*scan != room) {
+			previous = *scan;
+			scan = &((*scan) -> nextWaiting);
+		}
+
+		*scan = room -> nextWaiting;
+		if (table.lastWaiting == room) {
+			table.lastWaiting = previous;
+		}
+
+		room -> nextWaiting = NULL;
+		room -> freeSeats = 0;
+	}
+
+	pthread_mutex_unlock(&(table.lock));
+
+	return;
+}
+
+bool waitClients(serverRoom* room, int clientsCount) {
+	pthread_mutex_lock(&(table.lock));
+
+	while ((room -> clientsCount < clientsCount) && threadState) {
+		pthread_cond_wait(&(room -> clientJoined), &(table.lock));
+	}
+
+	bool joined = (room -> clientsCount >= clientsCount);
+
+	pthread_mutex_unlock(&(table.lock));
+
+	return joined;
+}
+
+int createServerList(serverRoom* room) {
+	// Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+	printf("\nWaiting the first user to connect...\n");
+
+	// The workers add the users while the search goes on
+	openSeats(room, MAX_CLIENTS);
+	
+	// Wait till the number of the user connected is reached
+	do {	
+		// Wait the next user
+		if (!waitClients(room, room -> clientsCount + 1)) {
+			break;
+		}
+
+		// Regex to clear the terminal.
+		printf("\e[1;1H\e[2J");
+
+		printf("\n-------------------- USERS CONNECTED --------------------\n");
+
+		// Print the users currently connected
+		for (int i = 0; i < room -> clientsCount; i++) {
+			printf("\n%d) Ip: %s ;", i + 1, room -> clients[i] -> ipAddress);
+		}
+
+		askToClose(room);
+
+	} while ((room -> clientsCount < MAX_CLIENTS) && (room -> searchConnectionsStatus != END));
+
+	closeSeats(room);
+
+	return room -> clientsCount;
+}
+
+void closeRoom(serverRoom* room) {
+	// Stop waiting users
+	closeSeats(room);
+
+	// Send what remains to send
+	flushAllData(room);
+
+	// Disconnect the clients of the room
+	for (int i = 0; i < room -> clientsCount; i++) {
+		roomClient* client = room -> clients[i];
+
+		if ((client -> socket != INVALID_SOCKET) && (room -> shard != NULL)) {
+			epoll_ctl(room -> shard -> epoll_fd, EPOLL_CTL_DEL, client -> socket, NULL);
+		}
+
+		closeConnection(client);
+	}
+
+	free(room -> clients);
+	room -> clients = NULL;
+	room -> clientsCount = 0;
+	room -> clientsCapacity = 0;
+
+	// Free the place of the room in its shard
+	if (room -> shard != NULL) {
+		pthread_mutex_lock(&shardsLock);
+		room -> shard -> roomsCount--;
+		pthread_mutex_unlock(&shardsLock);
+		room -> shard = NULL;
+	}
+
+	return;
+}
+
+void closeServer() {
+	printf("\nClosing the server!");
+
+	// Stop the event loop of every shard and wait its worker, waking up who is waiting a connection
+	pthread_mutex_lock(&(table.lock));
+	threadState = INACTIVE;
+	pthread_cond_broadcast(&(table.pendingAvailable));
+	for (serverRoom* scan = table.firstWaiting; scan != NULL; scan = scan -> nextWaiting) {
+		pthread_cond_broadcast(&(scan -> clientJoined));
+	}
+	pthread_mutex_unlock(&(table.lock));
+
+	for (int i = 0; i < shardsCount; i++) {
+		eventfd_write(shards[i].wakeup_fd, 1);
+		pthread_join(shards[i].thread, NULL);
+		close(shards[i].epoll_fd);
+		close(shards[i].wakeup_fd);
+	}
+	shardsCount = 0;
+
+	close(server_socket);
+
+	// Close the connections that no room has taken
+	refuseLateClients();
+
+	free(table.connections);
+	free(table.freeSlots);
+	table.connections = NULL;
+	table.freeSlots = NULL;
+	table.capacity = table.usedSlots = table.freeSlotsCount = 0;
+
+	printPoolStats(&messagesPool, "Messages");
+	printPoolStats(&nodesPool, "Nodes");
+	printPoolStats(&connectionsPool, "Connections");
+	printPoolStats(&buffersPool, "Buffers");
+	printPoolStats(&batchesPool, "Batches");
+	return;
+}
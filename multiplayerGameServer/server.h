@@ -1,33 +1,169 @@
-#include "utils.h"
-
-typedef enum utilsStatus {SEARCHING, END, INVALID_SOCKET = -1, INVALID_RESPONSE = -1} utilsStatus;
-
-/// @brief Load the server with its basic functions.
-/// @return Return the status of the operation.
-int loadServer();
-
-/// @brief Send the data to the given target.
-/// @param clientIndex 
-/// @param message 
-/// @param msgLen
-/// @return Return the status of the operation.
-bool sendData(int clientIndex, char* message);
-
-/// @brief Receive the data from the given target.
-/// @param clientSocket
-void* receiveData(void* vargp);
-
-/// @brief Get the number of elements in the list of messages received from the server.
-/// @return Return the len of the list.
-int getDataReceivedLen();
-
-/// @brief Retrieve the data sent by the server.
-/// @return Return the most recent message received, if there's.
-dataReceived getDataReceived();
-
-/// @brief Create the server list.
-/// @return Return the number of players connected to the server.
-int createServerList();
-
-/// @brief Close the server socket and deallocate the memory used.
+#include "utils.h"
+#include "catalog.h"
+
+#define NO_TIMEOUT -1
+#define ALL_CLIENTS 0
+
+typedef enum utilsStatus {SEARCHING, END, INVALID_SOCKET = -1, INVALID_RESPONSE = -1} utilsStatus;
+
+/// @brief Function that processes a message of a client of the room, it must release the data of the messages it takes.
+/// @return Return FALSE to leave the message to getDataReceived.
+typedef bool (*inputHandler)(void* context, int clientIndex, dataReceived message);
+
+/// @brief Create an empty room, where a game can collect its own clients.
+/// @return Return the room created.
+serverRoom* createRoom();
+
+/// @brief Give every message received from the clients of the room to the handler, on the worker of the room, before keeping it for getDataReceived.
+/// @param room 
+/// @param handler The handler to use, or NULL to keep the messages again.
+/// @param context Pointer given back to the handler.
+void setInputHandler(serverRoom* room, inputHandler handler, void* context);
+
+/// @brief Load the server with its basic functions.
+/// @param backlog Number of connections that the kernel keeps while the server hasn't accepted them yet.
+/// @return Return the status of the operation.
+int loadServer(int backlog);
+
+/// @brief Add a message with the given opcode to the batch of messages for the given target, the batch is sent with flushData.
+/// @param room 
+/// @param clientIndex 
+/// @param opcode 
+/// @param payload 
+/// @param payloadLen 
+/// @return Return the status of the operation.
+bool sendMessage(serverRoom* room, int clientIndex, protocolOpcode opcode, char* payload, int payloadLen);
+
+/// @brief Add a message with the given opcode and flags to the batch of messages for the given target.
+/// @param room 
+/// @param clientIndex 
+/// @param opcode 
+/// @param flags 
+/// @param payload 
+/// @param payloadLen 
+/// @return Return the status of the operation.
+bool sendFlaggedMessage(serverRoom* room, int clientIndex, protocolOpcode opcode, protocolFlags flags, char* payload, int payloadLen);
+
+/// @brief Encode a message with the given opcode once and add it to the batch of every client, except the given one.
+/// @param room 
+/// @param opcode 
+/// @param payload 
+/// @param payloadLen 
+/// @param exceptIndex Index of the client to skip, or ALL_CLIENTS.
+/// @return Return the status of the operation.
+bool broadcastMessage(serverRoom* room, protocolOpcode opcode, char* payload, int payloadLen, int exceptIndex);
+
+/// @brief Add the text to the batch of messages for the given target, the batch is sent with flushData.
+/// @param room 
+/// @param clientIndex 
+/// @param message 
+/// @return Return the status of the operation.
+bool sendData(serverRoom* room, int clientIndex, char* message);
+
+/// @brief Encode the text once and add it to the batch of every client, except the given one.
+/// @param room 
+/// @param message 
+/// @param exceptIndex Index of the client to skip, or ALL_CLIENTS.
+/// @return Return the status of the operation.
+bool broadcastData(serverRoom* room, char* message, int exceptIndex);
+
+/// @brief Add a text of the catalog to the batch of messages for the given target, sending only its id and parameters.
+/// @param room 
+/// @param clientIndex 
+/// @param id 
+/// @param ... The parameters of the text, in the same order of its placeholders.
+/// @return Return the status of the operation.
+bool sendCatalog(serverRoom* room, int clientIndex, catalogMessage id, ...);
+
+/// @brief Encode a text of the catalog once and add it to the batch of every client, except the given one.
+/// @param room 
+/// @param id 
+/// @param exceptIndex Index of the client to skip, or ALL_CLIENTS.
+/// @param ... The parameters of the text, in the same order of its placeholders.
+/// @return Return the status of the operation.
+bool broadcastCatalog(serverRoom* room, catalogMessage id, int exceptIndex, ...);
+
+/// @brief Send all the messages in the batch of the given target with a single write.
+/// @param room 
+/// @param clientIndex 
+/// @return Return the status of the operation.
+bool flushData(serverRoom* room, int clientIndex);
+
+/// @brief Send the batch of messages of every client, must be called before waiting for an input.
+/// @param room 
+/// @return Return the status of the operation.
+bool flushAllData(serverRoom* room);
+
+/// @brief Start a worker with its own event loop for every core, and let the first one accept the connections.
+/// @return Return the status of the operation.
+int startReceiving();
+
+/// @brief Refuse the connections made after the search of players has ended, closing also the ones that no room has taken.
+void refuseLateClients();
+
+/// @brief Assign the room to the least loaded worker, and register all its clients in the event loop of the worker.
+/// @param room 
+/// @return Return the status of the operation.
+int watchRoom(serverRoom* room);
+
+/// @brief Get the number of elements in the list of messages received from the given client.
+/// @param room 
+/// @param clientIndex
+/// @return Return the len of the list.
+int getDataReceivedLen(serverRoom* room, int clientIndex);
+
+/// @brief Retrieve the data sent by the given client, waiting without using the cpu till something arrives.
+/// @param room 
+/// @param clientIndex
+/// @param timeout Milliseconds to wait, 0 to not wait or NO_TIMEOUT to wait forever.
+/// @return Return the oldest message received from the client, if there's.
+dataReceived getDataReceived(serverRoom* room, int clientIndex, int timeout);
+
+/// @brief Give back the memory of a message retrieved with getDataReceived.
+/// @param data
+void releaseData(char* data);
+
+/// @brief Agree with the client on the version of the protocol to use, must be done before any other message.
+/// @param room 
+/// @param clientIndex 
+/// @return Return FALSE if the client doesn't support any version known by the server.
+bool negotiateProtocol(serverRoom* room, int clientIndex);
+
+/// @brief Answer the handshake sent by the client, choosing the version of the protocol to use.
+/// @param room 
+/// @param clientIndex 
+/// @param hello The handshake of the client, it's released.
+/// @return Return FALSE if the client doesn't support any version known by the server.
+bool acceptHandshake(serverRoom* room, int clientIndex, dataReceived hello);
+
+/// @brief Take the next connection accepted by the server and add it to the room, listening to it right away if the room is already watched.
+/// @param room 
+/// @return Return the index of the new client, or FALSE if the server is closing.
+int acceptClient(serverRoom* room);
+
+/// @brief Let the workers add to the room the next users that connect, without waiting that someone calls acceptClient, the room must be watched.
+/// @param room 
+/// @param seats The number of users to add.
+void openSeats(serverRoom* room, int seats);
+
+/// @brief Stop adding users to the room.
+/// @param room 
+void closeSeats(serverRoom* room);
+
+/// @brief Wait that the given number of users has joined the room.
+/// @param room 
+/// @param clientsCount 
+/// @return Return FALSE if the server is closing.
+bool waitClients(serverRoom* room, int clientsCount);
+
+/// @brief Create the server list.
+/// @param room 
+/// @return Return the number of players connected to the server.
+int createServerList(serverRoom* room);
+
+/// @brief Send what remains to the clients of the room and disconnect them.
+/// @param room 
+void closeRoom(serverRoom* room);
+
+/// @brief Close the server socket and deallocate the memory used.
 void closeServer();
\ No newline at end of file
@@ -1,3169 +1,2666 @@
-#include "utils.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <time.h>
-#include "server.h"
-
-/* INTERNALS VARIABLES INITIALIZATION AND INTERNALS FUNCTIONS DECLARATION */
-
-static GameStates gameState = UNSET;
-static int gameLevel;
-static int playerCount;
-static Player** players = NULL;
-static MapZone* firstZone = NULL;
-static MapZone* lastZone = NULL;
-static int* turns = NULL;
-static EvidenceType caravanEvidence[3];
-static ZoneType ghostPosition;
-static int ghostAppearance;
-static time_t currentTime;
-static int roundCount;
-
-static const char* zoneTypeNames[] = {"CARAVAN", "KITCHEN", "LIVING_ROOM", "ROOM", "BATHROOM", "GARAGE", "BASEMENT", "-"};
-static const char* objectsNames[] = {"-", "EMF", "SPIRIT_BOX", "CAMERA", "SEDATIVE", "SALT", "ADRENALINE", "HUNDRED_DOLLAR", "KNIFE", "TRANQUILLIZER", "NO_OBJECT", "EMF_EVIDENCE", "SPIRIT_BOX_EVIDENCE", "CAMERA_EVIDENCE", "NO_EVIDENCE", "EMPTY_SLOT"};
-static const char* difficultiesLevels[] = {"AMATEUR", "INTERMEDIATE", "NIGHTMARE"};
-static const char* colorsCodes[] = {"\x1b[1;30m", "\x1b[1;31m", "\x1b[1;32m", "\x1b[1;33m", "\x1b[1;34m", "\x1b[1;35m", "\x1b[1;36m", "\x1b[1;37m", "\x1b[1;0m"};
-static const int gameLevels[] = {15, 30, 50};
-
-/// @brief Insert a zone to the end of the list.
-static void insertZone();
-
-/// @brief Delete the last zone.
-static void deleteZone();
-
-/// @brief Print all the zones currently on the map.
-static void printZones();
-
-/// @brief Move the evidence from the player's backpack to the caravan, and set the player's position to the first zone.
-/// @param playerIndex 
-/// @return Return 1 if the player has an evidence, otherwise 0.
-static void goToCaravan(int playerIndex);
-
-/// @brief Print the info of the given player.
-/// @param playerIndex 
-/// @param currentTurn 
-static void printPlayer(int playerIndex, int currentTurn);
-
-/// @brief Print the info of the given zone.
-/// @param playerIndex
-/// @param currentTurn 
-static void printZone(int playerIndex, int currentTurn);
-
-/// @brief Move the given player to the next zone.
-/// @param playerIndex 
-static void goToNextZone(int playerIndex);
-
-/// @brief Pick an evidence from a zone if the player has the object to pick it.
-/// @param playerIndex 
-static void pickEvidence(int playerIndex);
-
-/// @brief Try to pick the object from the current player's position.
-/// @param playerIndex 
-static void pickObject(int playerIndex);
-
-/// @brief Use an object from the availables in the backpack. 
-/// @param playerIndex 
-/// @param currentTurn 
-static void useObject(int playerIndex, int currentTurn);
-
-/// @brief Give an object to another player.
-/// @param playerIndex 
-/// @param currentTurn 
-static void giveObjects(int playerIndex, int currentTurn);
-
-/// @brief Remove an object from the player's backpack.
-/// @param playerIndex 
-/// @param currentTurn 
-static void removeObject(int playerIndex, int currentTurn);
-
-/// @brief Let the user reorginize the backpack as he wants to.
-/// @param playerIndex 
-/// @param currentTurn 
-static void reorginizeBackpack(int playerIndex, int currentTurn);
-
-/// @brief Generate a random number in a given range.
-/// @param range 
-/// @return Return a random number in the given range.
-static int randomNumber(int range);
-
-/// @brief Generate the turns for a round.
-static void generateTurns();
-
-/// @brief Check if the players win or lose.
-static void checkGameStatus();
-
-/// @brief Print the info of the objects availables. 
-/// @param objects 
-static char* printObjectsInfo(unsigned char objects[]);
-
-/// @brief Print all the evidences that are in the caravan.
-/// @param playerIndex 
-/// @param currentTurn 
-static void printEvidenceCollected(int playerIndex, int currentTurn);
-
-/// @brief Print the info about the ghost.
-/// @param playerIndex 
-/// @param currentTurn 
-static void printGhostInfo(int playerIndex, int currentTurn);
-
-/// @brief Print using the given color.
-/// @param str 
-/// @param color 
-static void printColored(char* str, ColorType color);
-
-/// @brief Print the advice for the player.
-/// @param playerIndex
-static char* printAdvices(int playerIndex);
-
-/// @brief Play the turn as the game master.
-/// @param turnIndex 
-static void playTurn(int turnIndex);
-
-/* END OF INITIALIZATIONS AND DECLARATIONS */
-
-void set(int playerNum) {
-    // Reset the current time
-    currentTime = 0;
-
-    // Set the global variable player count
-    playerCount = playerNum;
-
-    // Regex to clear the terminal.
-    printf("\e[1;1H\e[2J");
-
-    // Allocate the space for the players
-    players = (Player**) calloc(playerCount, sizeof(Player*));
-
-    // Request the difficulty level
-    do {
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-        
-        printColored("\n------------- DIFFICULTY LEVELS -------------\n", MAGENTA);
-        printf("\n1) Amateur;");
-        printf("\n2) Intermediate;");
-        printf("\n3) Nightmare.");
-        printf("\nChoose the difficulty level from the option above: ");
-        scanf("%d", &gameLevel);
-
-        // Check if the game level selected is valid
-        if ((1 <= gameLevel) && (gameLevel <= 3)) {
-            gameLevel--;
-            break;
-        }
-
-        printColored("\nError: please insert a valid input!", RED);
-
-        {
-            // Clean the stdin
-            char c;
-            while ((c = getc(stdin)) != EOF) {
-                if (c == '\n'){
-                    break;
-                }
-            }
-
-            char confirm;
-            printColored("\n\nPress ENTER to continue: ", YELLOW);
-            scanf("%c", &confirm);
-        }
-
-    } while (TRUE);
-    
-    // Generate the game map
-    do {
-        int choice = 0;
-
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-
-        printColored("\n------------- MAP EDITOR -------------\n", MAGENTA);
-        printf("\n1) Insert a new zone;");
-        printf("\n2) Delete the last zone;");
-        printf("\n3) Print the zones currently on the map;");
-        printf("\n4) Close the map.");
-        printf("\nChoose between the option listed above: ");
-        scanf("%d", &choice);
-
-        switch (choice) {
-            case 1: 
-                insertZone();
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-                break;   
-
-            case 2: 
-                deleteZone();
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-                break;            
-            
-            case 3: 
-                printZones();
-                {
-                    // Clean the stdin
-                    char c;
-                    while((c = getc(stdin)) != EOF) {
-                        if(c == '\n') {
-                            break;          
-                        }
-                    } 
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-                break;
-
-            case 4:
-                // Check if the map has been set
-                if (firstZone == NULL) {
-                    printColored("Before closing the map, set at least one zone!\n", RED);
-
-                    {
-                        // Clean the stdin
-                        char c;
-                        while((c = getc(stdin)) != EOF) {
-                            if(c == '\n') {
-                                break;          
-                            }
-                        } 
-
-                        char confirm;
-                        printColored("\nPress ENTER to continue: ", YELLOW);
-                        scanf("%c", &confirm);
-                    }
-                    
-                    break;
-                }
-
-                return;
-
-            default:
-                printColored("\nError: please insert a valid input!", RED);
-
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-
-                break;
-        }
-
-    } while (TRUE);
-
-    return;
-}
-
-void setPlayers(int playerIndex, char* info) {
-    // Allocate the space in the heap for the player struct
-    Player* player = (Player*) malloc(sizeof(Player));
-
-    // Initialize the player mental health to 100
-    player -> mentalHealth = 100;
-
-    // If the player is the game master ask the name and the useadvice
-    if (playerIndex == 0) {
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-        
-        printColored("\n------------- PLAYER INFO -------------\n", MAGENTA);
-        
-        // Clean the stdin
-        {
-            char c;
-            while((c = getc(stdin)) != EOF) {
-                if(c == '\n') {
-                    break;          
-                }
-            }   
-        }
-
-        // Allocate the space for the player's name
-        player -> playerName = (char*) malloc(225);
-    
-        // Get the player's name
-        do {
-            printf("\nInsert the name of the player %s (MAX 225 characters)%s: ", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-
-            // Check if the input string contains the newline character
-            char *temp;
-            if ((temp = strchr(fgets((player -> playerName), 225, stdin), '\n')) != NULL) {
-                // Change the newline with the string terminator
-                *temp = '\0';
-
-                // Resize the size of the name array
-                player -> playerName = (char*) realloc(player -> playerName, strlen(player -> playerName) + 1);
-            } else {
-                // If the input string doesn't contain the newline than clean the stdin
-                char c;
-                while((c = getc(stdin)) != EOF) {
-                    if(c == '\n') {
-                        break;          
-                    }
-                }
-
-                // Change the newline with the string terminator
-                *temp = '\0';
-            }
-            
-            // Check if the given input string is empty or not
-            int isEmpty = 1;
-            for (int i = 0; player -> playerName[i] != '\0'; i++) {
-                if ((player -> playerName[i] != ' ')) {
-                    isEmpty = 0;
-                    break;
-                }
-            }
-
-            if (isEmpty) {
-                printColored("\nError: please insert a valid input!\n", RED);
-                continue;
-            } else {
-                break;
-            }
-
-        } while (TRUE);
-
-        // Ask if the player wants advice during the game
-        do {
-            char confirm;
-            printColored("\nDo you want to receive advices during the game? (Y/N): ", YELLOW);
-            scanf("%c", &confirm);
-
-            if (confirm == 'Y') {
-                player -> useAdvices = ACTIVE;
-                break;
-            } else if (confirm == 'N') {
-                player -> useAdvices = INACTIVE;
-                break;
-            }
-
-            printColored("\nError: please insert a valid input!\n", RED);
-
-        } while (TRUE);
-
-        {
-            // Clean the stdin
-            char c;
-            while ((c = getc(stdin)) != EOF) {
-                if (c == '\n'){
-                    break;
-                }
-            }
-
-            char confirm;
-            printColored("\n\nPress ENTER to continue: ", YELLOW);
-            scanf("%c", &confirm);
-        }
-
-
-    } else {
-        // Allocate the space for the player's name and load the name
-        int index;
-        player -> playerName = (char*) malloc(225);
-        for (index = 0; info[index] != '>'; index++) {
-            player -> playerName[index] = info[index];
-        }
-
-        player -> playerName[index] = '\0';
-        player -> playerName = (char*) realloc(player -> playerName, index);
-
-        // Set if the player uses advices
-        player -> useAdvices = (info[index + 1] == 'Y');
-    }
-
-    // Generate a random object for the player
-    player -> backpack[0] = randomNumber(5) + 1;
-
-    // Set the backpack's slots as empty
-    for (int i = 1; i < 4; i++) {
-        player -> backpack[i] = EMPTY_SLOT;
-    }
-
-    // Set the state of the salt protection to inactive
-    player -> saltProtection = INACTIVE;
-
-    // Set the player's position to the first zone
-    player -> position = firstZone;
-
-    // Add the player to the players array
-    players[playerIndex] = player;
-
-    return;
-}
-
-char* showGameSettings() {
-    char* result = (char*) malloc(2500);
-    int currentLen = 0;
-
-    // Show the current settings
-    currentLen += sprintf(result + currentLen, "%s\n------------- GAME SETTINGS -------------\n%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-
-    currentLen += sprintf(result + currentLen, "\nNumber of players: %d - (", playerCount);
-
-    for (int i = 0; i < playerCount; i++) {
-        currentLen += sprintf(result + currentLen, "%s%s", players[i] -> playerName, i != (playerCount - 1) ? ", " : ")");
-    }
-    
-    currentLen += sprintf(result + currentLen, "\nGame difficulty: %s\n", difficultiesLevels[gameLevel]);
-
-    currentLen += sprintf(result + currentLen, "%s\n------------- CURRENT MAP -------------\n%s", colorsCodes[CYAN], colorsCodes[DEFAULT_COLOR]);
-
-    currentLen += sprintf(result + currentLen, "\nFirst Zone: ");
-
-    for (MapZone* scan = firstZone; scan != lastZone; scan = (scan -> nextZone)) {
-        currentLen += sprintf(result + currentLen, "%s --> ", zoneTypeNames[scan -> zone]);
-    }
-    
-    // Check if last zone is already defined
-    if (lastZone != NULL) {
-        currentLen += sprintf(result + currentLen, "%s", zoneTypeNames[lastZone -> zone]);
-    }
-    
-    result = (char*) realloc(result, currentLen + 1);
-
-    return result;
-}
-
-void resetData() {
-    // Set to zero all the variables
-    roundCount = 0;
-    ghostPosition = NO_ZONE;
-    ghostAppearance = gameLevels[gameLevel];
-    for (int i = 0; i < 3; i++) {
-        caravanEvidence[i] = NO_EVIDENCE;
-    }
-
-    // Deallocate the turns if already used
-    if (turns != NULL) {
-        free(turns);
-        turns = NULL;
-    }
-
-    return;
-}
-
-static void playTurn(int turnIndex) {
-    Player* player = players[0];
-
-    // If the player has been eliminated skip his turn
-    if (player == NULL) {
-        return;
-    }
-
-    do {
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-
-        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (turnIndex + 1), players[0] -> playerName, colorsCodes[DEFAULT_COLOR]);
-
-        int choice = 0;
-        int turnStatus = PLAYING;
-
-        if (player -> useAdvices) {
-            printf("\n----------------------------------------------------------------------------------------------------\n");
-            char* advice = printAdvices(0);
-            printf("%s%s%s", colorsCodes[CYAN], advice, colorsCodes[DEFAULT_COLOR]);
-            printf("\n----------------------------------------------------------------------------------------------------\n");
-            free(advice);
-        }
-
-        printf("\n1) Go to the caravan to deposit all the evidence from the backpack;");
-        printf("\n2) Go to the next zone;");
-        printf("\n3) Pick the evidence from the current zone;");
-        printf("\n4) Pick the object from the current zone;");
-        printf("\n5) Use an object from the backpack;");
-        printf("\n6) Skip the turn;");
-        printf("\n7) Give an object to another player in the same room;");
-        printf("\n8) Remove an object;");
-        printf("\n9) Reorganize the backpack;");
-        printf("\n10) Print the player info;");
-        printf("\n11) Print the current zone info;");
-        printf("\n12) Print all the evidence in the caravan;");
-        printf("\n13) Print the ghost info;");
-        printf("\n14) Print the game info;");
-        printf("\n15) Exit the game.");
-        printf("\nChoose an action from the option above: ");
-        scanf("%d", &choice);
-
-        switch(choice) {
-            case 1:
-                // If there's a ghost the player can't go to the caravan
-                if (ghostPosition == (player -> position -> zone)) {
-                    printColored("\nYou can't go to the caravan, because there's a ghost at your position!", YELLOW);
-                } else {
-                    goToCaravan(0);
-                    turnStatus = FINISHED;
-                }
-                break;
-
-            case 2:
-                goToNextZone(0);
-                turnStatus = FINISHED;
-                break;
-
-            case 3: 
-                pickEvidence(0);
-                break;
-
-            case 4:
-                pickObject(0);
-                break;
-
-            case 5:
-                useObject(0, turnIndex);
-                break;
-
-            case 6:
-                turnStatus = FINISHED; 
-                printColored("\nYou have skipped your turn!", YELLOW);
-                break;
-
-            case 7:
-                giveObjects(0, turnIndex);
-                break;
-
-            case 8:
-                removeObject(0, turnIndex);
-                break;
-
-            case 9:
-                reorginizeBackpack(0, turnIndex);
-                break;
-
-            case 10:
-                printPlayer(0, turnIndex);
-                break;
-
-            case 11:
-                printZone(0, turnIndex);
-                break;
-
-            case 12:
-                printEvidenceCollected(0, turnIndex);
-                break;
-
-            case 13:
-                printGhostInfo(0, turnIndex);
-                break;
-
-            case 14:
-                // Regex to clear the terminal.
-                printf("\e[1;1H\e[2J");
-
-                printf("\n%sROUND: %d - TURN: %d\n%s", colorsCodes[MAGENTA], (roundCount + 1), (turnIndex + 1), colorsCodes[DEFAULT_COLOR]);
-
-                // Show the current settings
-                char* gameSettings = showGameSettings();
-
-                printf("%s", gameSettings);
-
-                free(gameSettings);
-
-                break;
-
-            case 15: 
-                close();
-                return;
-
-            default:
-                printColored("\nError: please insert a valid input!", RED);
-                break;
-        }
-
-        // If the player has finished the turn go to the next player turn
-        if (turnStatus == FINISHED) {
-            // The probability that the mental health decrease is 20 %
-            int randomNum = randomNumber(100);
-            
-            if (randomNum < 20) {
-                player -> mentalHealth -= 15;
-                printf("%s\n\nYour mental health has decreased to %d%s", colorsCodes[YELLOW], player -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-            }
-
-            {
-                // Clean the stdin
-                char c;
-                while ((c = getc(stdin)) != EOF) {
-                    if (c == '\n'){
-                        break;
-                    }
-                }
-
-                char confirm;
-                printColored("\n\nPress ENTER to continue: ", YELLOW);
-                scanf("%c", &confirm);
-            }
-
-            break;
-        }
-
-        {
-            // Clean the stdin
-            char c;
-            while ((c = getc(stdin)) != EOF) {
-                if (c == '\n'){
-                    break;
-                }
-            }
-
-            char confirm;
-            printColored("\n\nPress ENTER to continue: ", YELLOW);
-            scanf("%c", &confirm);
-        }
-
-    } while(TRUE);
-    
-    return;
-}
-
-static char* requestInput(int playerTurn) {
-    char* userInput;
-    if (!sendData(playerTurn, "UI")) {
-        printf("\nError while sending the advice!");
-    }
-
-    while((userInput = getDataReceived().data) == NULL);
-
-    return userInput;
-}
-
-void playGame() {
-    while (TRUE) {
-        // Generate the turns for this round
-        generateTurns();
-
-        // Play every player's turn 
-        for (int index = 0; index < playerCount; index++) {
-            // TODO: Check if the game has been closed otherwise you'll get some segfaults
-            int playerTurn = turns[index];
-
-            // Send to all the player the current info
-            for (int i = 1; i < playerCount; i++) {
-                if (i == (playerTurn - 1)) {
-                    if (!sendData(i, "IS_YOUR_TURN")) {
-                        printf("\nError while sending the turn info!");
-                    }
-                    continue;
-                }
-
-                if (!sendData(i, "NYT")) {
-                    printf("\nError while sending the turn info!");
-                }
-            }
-
-            // Check the status of the game
-            checkGameStatus();
-
-            // If the players win or lose end the game
-            if ((gameState == WIN) || (gameState == GAME_OVER)) {
-
-                // Regex to clear the terminal.
-                printf("\e[1;1H\e[2J");
-
-                printf("\n%s%s the players have %s!%s", gameState == WIN ? colorsCodes[GREEN] : colorsCodes[RED], gameState == WIN ? "The game ends," : "Game Over, ", gameState == WIN ? "won, congratulations" : "lost", colorsCodes[DEFAULT_COLOR]);
-
-                // Send the info of the end of the game to the players
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "\e[1;1H\e[2J\n%s%s the players have %s!%s", gameState == WIN ? colorsCodes[GREEN] : colorsCodes[RED], gameState == WIN ? "The game ends," : "Game Over, ", gameState == WIN ? "won, congratulations" : "lost", colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                for (int i = 1; i < playerCount; i++) {
-                    if (!sendData(i, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                }
-                free(info);
-
-                // Send every user the signal that the game has ended
-                for (int i = 1; i < playerCount; i++) {
-                    if (!sendData(i, "TG")) {
-                        printf("\nError while sending the info!");
-                    }
-                }
-
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-                
-                // Deallocate all the memory from the heap for the next game
-                close();
-
-                return;
-            }
-
-            // If the player has been eliminated skip his turn
-            if (players[playerTurn] == NULL) {
-                // Send the terminate turn signal
-                for (int i = 1; i < playerCount; i++) {                
-                    if (!sendData(i, "TT")) {
-                        printf("\nError while sending info");
-                    }
-                }
-                continue;
-            } 
-
-            do {
-                // Send to all the player the current info
-                char* turnInfo = (char*) malloc(125);
-                int size = sprintf(turnInfo, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (index + 1), players[playerTurn] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                turnInfo = (char*) realloc(turnInfo, size + 1);
-
-                for (int i = 1; i < playerCount; i++) {
-                    if (!sendData(i, turnInfo)) {
-                        printf("\nError while sending the turn info!");
-                    }
-                }
-
-                // Deallocate the temp variable
-                free(turnInfo);
-
-                // Send to all the player the current info
-                char* currentPlayerInfo = (char*) malloc(125);
-                int currentLen = sprintf(currentPlayerInfo, "%s\nWait the end of the current turn!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                currentPlayerInfo = (char*) realloc(currentPlayerInfo, currentLen + 1);
-
-                for (int i = 1; i < playerCount; i++) {
-                    if (i == playerTurn) {
-                        continue;
-                    }
-                    if (!sendData(i, currentPlayerInfo)) {
-                        printf("\nError while sending the turn info!");
-                    }
-                }
-
-                // Deallocate the temp variable
-                free(currentPlayerInfo);
-
-                // If the current player is the game master use his own function
-                if (playerTurn == 0) {
-                    playTurn(index);
-                    break;
-                }
-
-                printf("\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (index + 1), players[playerTurn] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                printColored("\nWait the end of the current turn!", YELLOW);
-
-                int choice = 0;
-                int turnStatus = PLAYING;
-
-                if (players[playerTurn] -> useAdvices) {
-                    char* temp = printAdvices(playerTurn);
-                    char spacer[] = "\n----------------------------------------------------------------------------------------------------\n";
-                    char* advice = (char*) malloc(750);
-                    int infoSize = sprintf(advice, "%s%s%s%s%s", spacer, colorsCodes[CYAN], temp, colorsCodes[DEFAULT_COLOR], spacer);
-                    advice = (char*) realloc(advice, infoSize + 1);
-                    if (!sendData(playerTurn, advice)) {
-                        printf("\nError while sending the advice!");
-                    }
-                    free(temp);
-                    free(advice);
-                } else {
-                    if (!sendData(playerTurn, "NO_ADVICE_SELECTED")) {
-                        printf("\nError while sending the advice!");
-                    }
-                }
-
-                // Send the menu info
-                if (!sendData(playerTurn, "\n1) Go to the caravan to deposit all the evidence from the backpack;\n2) Go to the next zone;\n3) Pick the evidence from the current zone;\n4) Pick the object from the current zone;\n5) Use an object from the backpack;\n6) Skip the turn;\n7) Give an object to another player in the same room;\n8) Remove an object;\n9) Reorganize the backpack;\n10) Print the player info;\n11) Print the current zone info;\n12) Print all the evidence in the caravan;\n13) Print the ghost info;\n14) Print the game info;\n15) Exit the game.\nChoose an action from the option above: ")) {
-                    printf("\nError while sending the advice!");
-                }
-
-                // Wait to get the input from the user
-                char* userInput = requestInput(playerTurn);
-
-                choice = atoi(userInput);
-
-                free(userInput);
-
-                switch(choice) {
-                    case 1:
-                        // If there's a ghost the player can't go to the caravan
-                        if (ghostPosition == (players[playerTurn] -> position -> zone)) {
-                            char* info = (char*) malloc(105);
-                            int size = sprintf(info, "%s\nYou can't go to the caravan, because there's a ghost at your position!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                            info = (char*) realloc(info, size + 1);
-                            if (!sendData(playerTurn, info)) {
-                                printf("\nError while sending info!");
-                                break;
-                            }
-                            free(info);
-                        } else {
-                            goToCaravan(playerTurn);
-                            turnStatus = FINISHED;
-                        }
-                        break;
-
-                    case 2:
-                        goToNextZone(playerTurn);
-                        turnStatus = FINISHED;
-                        break;
-
-                    case 3: 
-                        pickEvidence(playerTurn);
-                        break;
-
-                    case 4:
-                        pickObject(playerTurn);
-                        break;
-
-                    case 5:
-                        useObject(playerTurn, index);
-                        break;
-
-                    case 6:
-                        turnStatus = FINISHED; 
-                        {
-                            char* info = (char*) malloc(325);
-                            int size = sprintf(info, "%s\nYou have skipped your turn!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                            info = (char*) realloc(info, size + 1);
-                            
-                            if (!sendData(playerTurn, info)) {
-                                printf("\nError while sending the info!");
-                            }
-                            
-                            free(info);
-                        }
-                        break;
-
-                    case 7:
-                        giveObjects(playerTurn, index);
-                        break;
-
-                    case 8:
-                        removeObject(playerTurn, index);
-                        break;
-
-                    case 9:
-                        reorginizeBackpack(playerTurn, index);
-                        break;
-
-                    case 10:
-                        printPlayer(playerTurn, index);
-                        break;
-
-                    case 11:
-                        printZone(playerTurn, index);
-                        break;
-
-                    case 12:
-                        printEvidenceCollected(playerTurn, index);
-                        break;
-
-                    case 13:
-                        printGhostInfo(playerTurn, index);
-                        break;
-
-                    case 14:
-                        {                     
-                            // Show the current settings
-                            char* info = (char*) malloc(1000);
-                            char* gameSettings = showGameSettings();
-                            int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s%s", colorsCodes[MAGENTA], (roundCount + 1), (index + 1), players[playerTurn] -> playerName, colorsCodes[DEFAULT_COLOR], gameSettings);
-                            info = (char*) realloc(info, size + 1);
-                            
-                            if (!sendData(playerTurn, info)) {
-                                printf("\nError while sending the info!");
-                            }
-
-                            free(gameSettings);
-                            free(info);
-                        }
-
-                        break;
-
-                    case 15: 
-                        close();
-                        return;
-
-                    default:
-                        {                            
-                            char* info = (char*) malloc(125);
-                            int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                            info = (char*) realloc(info, size + 1);
-                            
-                            if (!sendData(playerTurn, info)) {
-                                printf("\nError while sending the info!");
-                            }
-
-                            free(info);
-                        }
-                        
-                        break;
-                }
-
-                // If the player has finished the turn go to the next player turn
-                if (turnStatus == FINISHED) {
-                    // The probability that the mental health decrease is 20 %
-                    int randomNum = randomNumber(100);
-                    
-                    if (randomNum < 20) {
-                        players[playerTurn] -> mentalHealth -= 15;
-                        
-                        if (playerTurn) {
-                            char* info = (char*) malloc(125);
-                            int size = sprintf(info, "%s\n\nYour mental health has decreased to %d%s", colorsCodes[YELLOW], players[playerTurn] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                            info = (char*) realloc(info, size + 1);
-                            
-                            if (!sendData(playerTurn, info)) {
-                                printf("\nError while sending the info!");
-                            }
-
-                            free(info);
-                        } else {
-                            printf("%s\n\nYour mental health has decreased to %d%s", colorsCodes[YELLOW], players[playerTurn] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                        }
-                    }
-
-                    // Ask to confirm
-                    char* tempInfo = (char*) malloc(150);
-                    int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                    tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                    if (!sendData(playerTurn, tempInfo)) {
-                        printf("\nError while sending the advice!");
-                    }
-
-                    free(tempInfo);
-
-                    // Before going to the next turn wait that the player confirms that has read that
-                    requestInput(playerTurn);
-
-                    // Send the terminate turn signal
-                    for (int i = 1; i < playerCount; i++) {                
-                        if (!sendData(i, "TT")) {
-                            printf("\nError while sending info");
-                        }
-                    }
-
-                    break;
-                }
-
-                // Ask to confirm
-                char* tempInfo = (char*) malloc(150);
-                int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                if (!sendData(playerTurn, tempInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-
-                free(tempInfo);
-
-                // Before going to the next turn wait that the player confirms that has read that
-                requestInput(playerTurn);
-            
-            } while(TRUE);
-
-        }
-
-        roundCount++;
-    }
-
-    return;
-}
-
-void close() {
-    // Deallocate all the players alive
-    free(players);
-    players = NULL;
-
-    // Recursively deallocate all the element from the list until the first zone is deallocated
-    while (firstZone != NULL) {
-        deleteZone();
-    }
-    
-    // Deallocate the turns if already used
-    if (turns != NULL) {
-        free(turns);
-        turns = NULL;
-    }
-
-    // Set the game status to unset
-    gameState = UNSET;
-
-    return;
-}
-
-/* INTERNALS FUNCTIONS DEFINITION */
-
-static void insertZone() {
-    // Allocate the space for a new zone
-    MapZone* newZone = (MapZone*) malloc(sizeof(MapZone));
-
-    // Initialize the linked list if isn't already initialized
-    if (firstZone == NULL) {
-        // Set the first zone as the new zone created
-        firstZone = newZone;
-        
-        // Set the last zone equal to the first zone to make the list circular
-        lastZone = firstZone;
-        
-        // Set the last zone as the next zone
-        firstZone -> nextZone = lastZone;
-
-        // Generate the type of zone (excluding the CARAVAN type)
-        firstZone -> zone = randomNumber(6) + 1;
-
-        // Generate the object inside the zone
-        int randomObject = randomNumber(6) + 6;
-    
-        // If the generated object is equal to 11, assign it as NO_OBJECT (= 10)
-        firstZone -> zoneObject = randomObject == 11 ? randomObject - 1 : randomObject;
-        
-        // Set the evidence in the zone as empty
-        firstZone -> evidence = 0;
-
-        return printZones();
-    }
-    
-    // The old last zone point to the new last zone
-    lastZone -> nextZone = newZone;
-
-    // Set the last zone as the new zone created
-    lastZone = newZone;
-
-    // Set the first zone as the next zone
-    lastZone -> nextZone = firstZone;
-
-    // Generate the type of zone (excluding the CARAVAN type)
-    lastZone -> zone = randomNumber(6) + 1;
-
-    // Generate the object inside the zone
-    int randomObject = randomNumber(6) + 6;
-    
-    // If the generated object is equal to 11, assign it as NO_OBJECT (= 10)
-    lastZone -> zoneObject = randomObject == 11 ? randomObject - 1 : randomObject;
-
-    // Set the evidence in the zone as empty
-    lastZone -> evidence = 0;
-
-    return printZones();
-}
-
-static void deleteZone() {
-    // If the first zone is NULL, than the list is empty
-    if (firstZone == NULL) {
-        printColored("\nThe map is already empty!", YELLOW);
-        return;
-    }
-    
-    // If the list has only one element reset the list
-    if (firstZone == lastZone) {
-        free(firstZone);
-        firstZone = NULL;
-        lastZone = NULL;
-        return printZones();
-    }
-
-    // Search for the zone that points to the last zone
-    MapZone* scan;
-    for (scan = firstZone; (scan -> nextZone) != lastZone; scan = (scan -> nextZone));
-    
-    // Deallocate the last zone
-    free(lastZone);
-
-    // Set the element before the last zone as the new last zone
-    lastZone = scan;
-
-    // Set the first zone as the next zone
-    lastZone -> nextZone = firstZone;
-
-    return printZones();
-}
-
-static void printZones() {
-    // If the first zone is NULL, than the list is empty
-    if (firstZone == NULL) {
-        printColored("\nThe map is empty!", YELLOW);
-        return;
-    }
-
-    printColored("\n------------- CURRENT MAP -------------\n", CYAN);
-    printf("\nFirst Zone: ");
-
-    for (MapZone* scan = firstZone; scan != lastZone; scan = (scan -> nextZone)) {
-        printf("%s --> ", zoneTypeNames[scan -> zone]);
-    }
-    
-    // Check if last zone is already defined
-    if (lastZone != NULL) {
-        printf("%s", zoneTypeNames[lastZone -> zone]);
-    }
-
-    return;
-}
-
-static void goToCaravan(int playerIndex) {
-    // Move all the evidence in the backpack to the caravan
-    int hasEvidences = 0;
-
-    for (int i = 0; i < 4; i++) {
-        unsigned char backpackSlot = players[playerIndex] -> backpack[i];
-        
-        // Check if the current slot is empty or if is not of type EvidenceType
-        if ((backpackSlot == EMPTY_SLOT) || (backpackSlot < 11)) {
-            continue;
-        } else {
-            hasEvidences = 1;
-            // Add the evidence to a slot determined by the type of evidence, to prevent duplicate
-            caravanEvidence[backpackSlot - 11] = backpackSlot;
-
-            // Set the backpack slot to empty
-            players[playerIndex] -> backpack[i] = EMPTY_SLOT;
-
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("%s\nEvidence (%s) has been left in the caravan!%s", colorsCodes[MAGENTA], objectsNames[backpackSlot], colorsCodes[DEFAULT_COLOR]);
-            } else {
-                char* info = (char*) malloc(450);
-                int size = sprintf(info, "%s\nEvidence (%s) has been left in the caravan!%s", colorsCodes[MAGENTA], objectsNames[backpackSlot], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-        }
-    }
-
-    // Check if the player has evidences
-    if (!hasEvidences) {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printColored("\nYou don't have evidences!", YELLOW);      
-        } else {
-            char* info = (char*) malloc(65);
-            int size = sprintf(info, "%s\nYou don't have evidences!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-    }
-
-    // Set the player position to the first zone
-    players[playerIndex] -> position = firstZone;
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        printColored("\nYou have been repositioned in the first zone!", MAGENTA);     
-    } else {
-        char* info = (char*) malloc(85);
-        int size = sprintf(info, "%s\nYou have been repositioned in the first zone!%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    return;
-}
-
-static void printPlayer(int playerIndex, int currentTurn) {
-    Player* player = players[playerIndex];
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-        printColored("\n------------- PLAYER INFO -------------\n", MAGENTA);
-        printf("\nName: %s", player -> playerName);
-        printf("\nMental Health: %d", player -> mentalHealth);
-        printf("\nPosition: %s", zoneTypeNames[player -> position -> zone]);
-        printf((players[playerIndex] -> useAdvices) ? "\nThe advices are active" : "\nThe advices are inactive");
-        printf((players[playerIndex] -> saltProtection) ? "\nThe salt protection is active" : "\nThe salt protection is inactive");
-
-    } else {
-        char* useAdv = (players[playerIndex] -> useAdvices) ? "\nThe advices are active" : "\nThe advices are inactive";
-        char* useSalt = (players[playerIndex] -> saltProtection) ? "\nThe salt protection is active" : "\nThe salt protection is inactive";
-        char* info = (char*) malloc(750);
-        int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- PLAYER INFO -------------\n%s\nGhost position: %s\nGhost appeareance probability: %d%%\nName: %s\nMental Health: %d\nPosition: %s%s%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR], zoneTypeNames[ghostPosition], ghostAppearance, player -> playerName, player -> mentalHealth, zoneTypeNames[player -> position -> zone], useAdv, useSalt);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-    
-    // Print the backpack's slots
-    for (int i = 0; i < 4; i++) {
-        int slot = player -> backpack[i];
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printf("\nSlot %d: %s", (i + 1), objectsNames[slot]);
-        } else {
-            char* info = (char*) malloc(250);
-            int size = sprintf(info, "\nSlot %d: %s", (i + 1), objectsNames[slot]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-    }
-
-    return;
-}
-
-static void printZone(int playerIndex, int currentTurn) {
-    MapZone* currentZone = players[playerIndex] -> position;
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-    // Regex to clear the terminal.
-    printf("\e[1;1H\e[2J");
-    printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-    printColored("\n------------- ZONE INFO -------------\n", MAGENTA);
-    printf("\nCurrent zone: %s", zoneTypeNames[currentZone -> zone]);
-    printf("\nEvidence in the current zone: %s", objectsNames[currentZone -> evidence]);
-    printf("\nObject in the current zone: %s", objectsNames[currentZone -> zoneObject]);
-    printf("\nNext zone: %s", zoneTypeNames[currentZone -> nextZone -> zone]);
-
-    } else {
-        char* info = (char*) malloc(750);
-        int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- ZONE INFO -------------\n%s\nCurrent zone: %s\nEvidence in the current zone: %s\nObject in the current zone: %s\nNext zone: %s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR], zoneTypeNames[currentZone -> zone], objectsNames[currentZone -> evidence], objectsNames[currentZone -> zoneObject], zoneTypeNames[currentZone -> nextZone -> zone]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    return;
-}
-
-static void goToNextZone(int playerIndex) {
-    // Generate the object for the current zone if there aren't
-    if ((players[playerIndex] -> position -> zoneObject) == NO_OBJECT) {
-        int randomObject = randomNumber(10) + 1;
-        players[playerIndex] -> position -> zoneObject = randomObject;
-        
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printf("%s\nThe object in the %s has been added!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-        } else {
-            char* info = (char*) malloc(125);
-            int size = sprintf(info, "%s\nThe object in the %s has been added!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-    }
-
-    // Move the player position to the next zone
-    players[playerIndex] -> position = players[playerIndex] -> position -> nextZone;
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        printf("%s\nYou have been repositioned in the %s!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-    } else {
-        char* info = (char*) malloc(125);
-        int size = sprintf(info, "%s\nYou have been repositioned in the %s!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    // Change the evidence in the zone reached by the player
-    int randomEvidence = randomNumber(5) + 11;
-    
-    // If the generated num is equal to 15, assign it as NO_EVIDENCE (= 14)
-    EvidenceType newEvidence = randomEvidence == 15 ? randomEvidence - 1 : randomEvidence;
-    players[playerIndex] -> position -> evidence = newEvidence;
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        printf("%s\nThe evidence in the %s has been changed!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-    } else {
-        char* info = (char*) malloc(125);
-        int size = sprintf(info, "%s\nThe evidence in the %s has been changed!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    // Generate the object for the zone reached if there aren't
-    if ((players[playerIndex] -> position -> zoneObject) == NO_OBJECT) {
-        int randomObject = randomNumber(10) + 1;
-        players[playerIndex] -> position -> zoneObject = randomObject;
-        
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printf("%s\nThe object in the %s has been added!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-        } else {
-            char* info = (char*) malloc(125);
-            int size = sprintf(info, "%s\nThe object in the %s has been added!%s", colorsCodes[MAGENTA], zoneTypeNames[players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-    }
-
-    return;
-}
-
-static void pickEvidence(int playerIndex) {
-    unsigned char currentZoneEvidence = players[playerIndex] -> position -> evidence;
-
-    if (currentZoneEvidence == NO_EVIDENCE) {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printColored("\nThere's no object in this zone that can be picked!", YELLOW);
-        } else {
-            char* info = (char*) malloc(125);
-            int size = sprintf(info, "%s\nThere's no object in this zone that can be picked!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-
-        return;
-    }
-
-    // Check if there's the object to pick the evidence, decrement the evidence by 10 to get the object needed to pick it
-    // And if there's change the object with the evidence
-    for (int i = 0; i < 4; i++) {
-        if ((players[playerIndex] -> backpack[i]) == (currentZoneEvidence - 10)) {
-            players[playerIndex] -> backpack[i] = currentZoneEvidence;
-            
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("%s\nEvidence %s has been picked!%s", colorsCodes[MAGENTA], objectsNames[players[playerIndex] -> backpack[i]], colorsCodes[DEFAULT_COLOR]);
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nEvidence %s has been picked!%s", colorsCodes[MAGENTA], objectsNames[players[playerIndex] -> backpack[i]], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-
-            // Generate a random number to check the possibility that the ghost appears
-            int randomNum = randomNumber(100);
-            if (randomNum < ghostAppearance) {
-                // Spawn the ghost in the same zone as the current player
-                ghostPosition = players[playerIndex] -> position -> zone;
-                
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("%s\nThe ghost spawn in the %s zone!%s", colorsCodes[MAGENTA], zoneTypeNames[ghostPosition], colorsCodes[DEFAULT_COLOR]);
-                } else {
-                    char* info = (char*) malloc(125);
-                    int size = sprintf(info, "%s\nThe ghost spawn in the %s zone!%s", colorsCodes[MAGENTA], zoneTypeNames[ghostPosition], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-
-                // Check if there's a player in the same position as the ghost, and if so decrement his mental health
-                for (int index = 0; index < playerCount; index++) {
-                    // Check if the player has been eliminated
-                    if (players[index] == NULL) {
-                        continue;
-                    }
-
-                    // If the player has used the SALT before, then his mental health won't decrement
-                    if (((players[index] -> position -> zone) == ghostPosition) && (!(players[playerIndex] -> saltProtection))) {
-                        switch (gameLevel) {
-                            case AMATEUR:
-                                players[index] -> mentalHealth -= DECREMENT_AMATEUR;
-                                break;
-
-                            case INTERMEDIATE:
-                                players[index] -> mentalHealth -= DECREMENT_INTERMEDIATE;
-                                break;
-
-                            case NIGHTMARE:
-                                players[index] -> mentalHealth -= DECREMENT_NIGHTMARE;
-                                break;
-                        }
-                        
-
-                        // Send the info if is not the game master
-                        if (playerIndex == 0) {
-                            printf("%s\nThe ghost is in the same room as %s, so %s's mental health decrease to %d!%s", colorsCodes[MAGENTA], players[index] -> playerName, players[index] -> playerName, players[index] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                        } else {
-                            char* info = (char*) malloc(325);
-                            int size = sprintf(info, "%s\nThe ghost is in the same room as %s, so %s's mental health decrease to %d!%s", colorsCodes[MAGENTA], players[index] -> playerName, players[index] -> playerName, players[index] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                            info = (char*) realloc(info, size + 1);
-                            if (!sendData(playerIndex, info)) {
-                                printf("\nError while sending the info!");
-                            }
-                            free(info);
-                        }
-                    
-                    }
-                }
-            }
-
-            // Increment the possibility that a ghost appears (based on the difficulty)
-            switch (gameLevel) {
-                case AMATEUR:
-                    ghostAppearance += INCREMENT_AMATEUR;
-                    break;  
-
-                case INTERMEDIATE:
-                    ghostAppearance += INCREMENT_INTERMEDIATE;
-                    break;        
-                    
-                case NIGHTMARE:
-                    ghostAppearance += INCREMENT_NIGHTMARE;
-                    break;
-            }
-
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("%s\nThe probabilities that the ghost appears have been increased to %d%% %s", colorsCodes[MAGENTA], ghostAppearance, colorsCodes[DEFAULT_COLOR]);
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nThe probabilities that the ghost appears have been increased to %d%% %s", colorsCodes[MAGENTA], ghostAppearance, colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-
-            return;
-        }
-    }
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        printColored("\nYou don't have the object to pick the evidence in this zone!", YELLOW);
-    } else {
-        char* info = (char*) malloc(125);
-        int size = sprintf(info, "%s\nYou don't have the object to pick the evidence in this zone!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    return;
-}
-
-static void pickObject(int playerIndex) {
-    // Check if there's an object in the zone
-    if ((players[playerIndex] -> position -> zoneObject) == NO_OBJECT) {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printColored("\nThe current zone has no objects!", YELLOW);
-        } else {
-            char* info = (char*) malloc(125);
-            int size = sprintf(info, "%s\nThe current zone has no objects!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-
-        return;
-    }
-
-    // Check if there's an empty slot for the object
-    for (int i = 0; i < 4; i++) {
-        if (players[playerIndex] -> backpack[i] == EMPTY_SLOT) {
-            // Set the object in the backpack
-            players[playerIndex] -> backpack[i] = players[playerIndex] -> position -> zoneObject;
-
-            // Set the object in this zone to none, as it has been picked
-            players[playerIndex] -> position -> zoneObject = NO_OBJECT;
-            
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("%s\nYou have picked the %s!%s", colorsCodes[MAGENTA], objectsNames[players[playerIndex] -> backpack[i]], colorsCodes[DEFAULT_COLOR]);
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nYou have picked the %s!%s", colorsCodes[MAGENTA], objectsNames[players[playerIndex] -> backpack[i]], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-
-            return;
-        }
-    }
-
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        printColored("\nThe backpack's slots are full, you can't pick the object!", YELLOW);
-    } else {
-        char* info = (char*) malloc(125);
-        int size = sprintf(info, "%s\nThe backpack's slots are full, you can't pick the object!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    return;
-}
-
-static void useObject(int playerIndex, int currentTurn) {
-    do {
-        int choice = 0;
-        unsigned char usableObjects[] = {0, 0, 0, 0};
-        int usableObjectsCount = 0;
-
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            // Regex to clear the terminal.
-            printf("\e[1;1H\e[2J");
-
-            printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            printColored("\n------------- USABLE OBJECTS -------------\n", MAGENTA);
-
-        } else {
-            char* info = (char*) malloc(350);
-            int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- USABLE OBJECTS -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-
-
-        for (int i = 0; i < 4; i++) {
-            // Print as options only the objects that aren't used for the 
-            unsigned char backpackObject = players[playerIndex] -> backpack[i];
-            if ((3 < backpackObject) && (backpackObject < 10)) {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("\n%d) Use the %s;", i + 1, objectsNames[backpackObject]);
-                } else {
-                    char* info = (char*) malloc(85);
-                    int size = sprintf(info, "\n%d) Use the %s;", i + 1, objectsNames[backpackObject]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-
-                // Add the object to the object effects that can be shown if requested by the user
-                usableObjects[usableObjectsCount] = backpackObject;
-                usableObjectsCount++;
-            }
-        }
-
-        // Check if there's object to be used in the backpack
-        if (usableObjectsCount == 0) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printColored("\nThere aren't object that can be used!", YELLOW);
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nThere aren't object that can be used!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-
-            return;
-        }
-
-        // Print the commands only if is the game master
-        if (!playerIndex) {
-            // Add an option to list all the effects of the objects availables
-            printf("\n5) Print all the effects of the objects availables;");
-
-            // Add an option to exit the menu
-            printf("\n6) Exit the menu.");
-
-            printf("\nChoose from the option above: ");
-            scanf("%d", &choice);
-        } else {
-            // Ask to choose an option
-            if (!sendData(playerIndex, "\n5) Print all the effects of the objects availables;\n6) Exit the menu.\nChoose from the option above: ")) {
-                printf("\nError while sending the advice!");
-            }
-
-            // Wait the user input
-            char* userInput = requestInput(playerIndex);
-
-            choice = atoi(userInput);
-
-            free(userInput);
-        }
-
-        // Check if the given input is between 1 and 6
-        if ((1 > choice) || (choice > 6)) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printColored("\nError: please insert a valid input!", RED);
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-            
-            if (!playerIndex) {
-                // Clean the stdin
-                char c;
-                while ((c = getc(stdin)) != EOF) {
-                    if (c == '\n'){
-                        break;
-                    }
-                }
-
-                char confirm;
-                printColored("\n\nPress ENTER to continue: ", YELLOW);
-                scanf("%c", &confirm);
-            } else {
-                // Ask to confirm
-                char* tempInfo = (char*) malloc(150);
-                int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                if (!sendData(playerIndex, tempInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-                
-                free(tempInfo);
-                
-                // Wait the user to continue
-                requestInput(playerIndex);
-            }
-
-            continue;
-        } 
-        
-        // Check if the player chose one of the extra optons
-        if (choice == 5) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                // Regex to clear the terminal.
-                printf("\e[1;1H\e[2J");
-                printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                printColored("\n------------- OBJECTS INFO -------------\n", MAGENTA);
-                printf("%s", printObjectsInfo(usableObjects));
-
-            } else {
-                char* info = (char*) malloc(350);
-                int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- OBJECTS INFO -------------\n%s%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR], printObjectsInfo(usableObjects));
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-
-                free(info);
-            }
-            
-            // Reset the usable objects list
-            for (int i = 0; i < 4; i++) {
-                usableObjects[i] = 0;
-            }
-
-            if (!playerIndex) {
-                // Clean the stdin
-                char c;
-                while ((c = getc(stdin)) != EOF) {
-                    if (c == '\n'){
-                        break;
-                    }
-                }
-
-                char confirm;
-                printColored("\n\nPress ENTER to continue: ", YELLOW);
-                scanf("%c", &confirm);
-            } else {
-                // Ask to confirm
-                char* tempInfo = (char*) malloc(150);
-                int tempInfoSize = sprintf(tempInfo, "\n\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                if (!sendData(playerIndex, tempInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-                
-                free(tempInfo);
-                
-                // Wait the user to continue
-                requestInput(playerIndex);
-            }
-
-            continue;
-
-        } else if (choice == 6) {
-            return;
-        }
-
-        switch (players[playerIndex] -> backpack[choice - 1]) {
-            case 4:
-                // Use the SEDATIVE object to increase the mental health by 40
-                players[playerIndex] -> mentalHealth += 40;
-                players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;  
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("%s\nYou used the SEDATIVE, and your mental health has increased to %d!%s", colorsCodes[MAGENTA], players[playerIndex] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                } else {
-                    char* info = (char*) malloc(250);
-                    int size = sprintf(info, "%s\nYou used the SEDATIVE, and your mental health has increased to %d!%s", colorsCodes[MAGENTA], players[playerIndex] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-                return;       
-            
-            case 5:
-                // Use the SALT to prevent a decrement of the mental health, caused by the ghost
-                players[playerIndex] -> saltProtection = 1;
-                players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printColored("\nYou used the SALT, the next appearence of the ghost won't affect your mental health!", MAGENTA);
-                } else {
-                    char* info = (char*) malloc(250);
-                    int size = sprintf(info, "%s\nYou used the SALT, the next appearence of the ghost won't affect your mental health!%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-                return;            
-            
-            case 6:
-                // Use the ADRENALINE to go to the next zone and obtain an extra turn
-                players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printColored("\nYou used the ADRENALINE, and went to the next zone, obtaining an extra turn!", MAGENTA);
-                } else {
-                    char* info = (char*) malloc(250);
-                    int size = sprintf(info, "%s\nYou used the ADRENALINE, and went to the next zone, obtaining an extra turn!%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-                return goToNextZone(playerIndex);            
-            
-            case 7:
-                // Use the HUNDRED_DOLLAR to buy a TRANQUILLIZER or SALT
-                do {
-                    int option = 0;
-                    // Send the info if is not the game master
-                    if (playerIndex == 0) {
-                        printf("\nChoose what you want to buy between: ");
-                        printf("\n1) TRANQUILLIZER;");
-                        printf("\n2) SALT.");
-                        printf("\nInsert an option: ");
-                        scanf("%d", &option);
-                    } else {
-                        if (!sendData(playerIndex, "\nChoose what you want to buy between: \n1) TRANQUILLIZER;\n2) SALT.\nInsert an option: ")) {
-                            printf("\nError while sending the info!");
-                        }
-
-                        // Wait for the user input
-                        char* userInput = requestInput(playerIndex);
-
-                        option = atoi(userInput);
-
-                        free(userInput);
-                    }
-
-                    switch (option) {
-                        case 1:
-                            players[playerIndex] -> backpack[choice - 1] = TRANQUILLIZER;
-                            // Send the info if is not the game master
-                            if (playerIndex == 0) {
-                                printColored("\nYou bought the TRANQUILLIZER!", MAGENTA);
-                            } else {
-                                char* info = (char*) malloc(125);
-                                int size = sprintf(info, "%s\nYou bought the TRANQUILLIZER!%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-                                info = (char*) realloc(info, size + 1);
-                                if (!sendData(playerIndex, info)) {
-                                    printf("\nError while sending the info!");
-                                }
-                                free(info);
-                            }
-                            return;                    
-
-                        case 2:
-                            players[playerIndex] -> backpack[choice - 1] = SALT;
-                            // Send the info if is not the game master
-                            if (playerIndex == 0) {
-                                printColored("\nYou bought the SALT!", MAGENTA);
-                            } else {
-                                char* info = (char*) malloc(125);
-                                int size = sprintf(info, "%s\nYou bought the SALT!%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-                                info = (char*) realloc(info, size + 1);
-                                if (!sendData(playerIndex, info)) {
-                                    printf("\nError while sending the info!");
-                                }
-                                free(info);
-                            }
-                            return;
-
-                        default:
-                            // Send the info if is not the game master
-                            if (playerIndex == 0) {
-                                printColored("\nError: please insert a valid input!", RED);
-                            } else {
-                                char* info = (char*) malloc(125);
-                                int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                                info = (char*) realloc(info, size + 1);
-                                if (!sendData(playerIndex, info)) {
-                                    printf("\nError while sending the info!");
-                                }
-                                free(info);
-                            }
-                            break;
-                    }
-
-                } while (TRUE);
-
-                return;            
-            
-            case 8:
-                // Use the KNIFE and if the mental health is under 30 kill all the players in the same zone as the current player
-                ZoneType currentZone = ((players[playerIndex]) -> position) -> zone;
-                players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
-                
-                if ((players[playerIndex] -> mentalHealth) < 30) {
-                    for (int i = 0; i < playerCount; i++) {
-                        // Check if the player has been eliminated
-                        if (players[i] == NULL) {
-                            continue;
-                        }
-
-                        if ((i != playerIndex) && ((players[i] -> position -> zone) == currentZone)) {
-                            free(players[playerIndex]);
-                            players[playerIndex] = NULL;
-                            
-                            // Send the info if is not the game master
-                            if (playerIndex == 0) {
-                                printf("%s\nYou used the KNIFE, and killed %s!%s", colorsCodes[MAGENTA], players[i] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                            } else {
-                                char* info = (char*) malloc(250);
-                                int size = sprintf(info, "%s\nYou used the KNIFE, and killed %s!%s", colorsCodes[MAGENTA], players[i] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                                info = (char*) realloc(info, size + 1);
-                                if (!sendData(playerIndex, info)) {
-                                    printf("\nError while sending the info!");
-                                }
-                                free(info);
-                            }
-                        }
-                    }
-
-                } else {
-                    // Send the info if is not the game master
-                    if (playerIndex == 0) {
-                        printColored("\nYou used the KNIFE, but you didn't hurt anybody!", MAGENTA);
-                    } else {
-                        char* info = (char*) malloc(125);
-                        int size = sprintf(info, "%s\nYou used the KNIFE, but you didn't hurt anybody!%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
-                        info = (char*) realloc(info, size + 1);
-                        if (!sendData(playerIndex, info)) {
-                            printf("\nError while sending the info!");
-                        }
-                        free(info);
-                    }
-                }
-
-
-                return;            
-            
-            case 9:
-                // Use the TRANQUILLIZER object to increase the mental health by 40
-                players[playerIndex] -> mentalHealth += 40;
-                players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;         
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("%s\nYou used the TRANQUILLIZER, and your mental health has increased to %d!%s",  colorsCodes[MAGENTA], players[playerIndex] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                } else {
-                    char* info = (char*) malloc(125);
-                    int size = sprintf(info, "%s\nYou used the TRANQUILLIZER, and your mental health has increased to %d!%s",  colorsCodes[MAGENTA], players[playerIndex] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-                return;   
-
-            default:
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printColored("\nError: please insert a valid input!", RED);
-                } else {
-                    char* info = (char*) malloc(125);
-                    int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-
-                if (!playerIndex) {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                } else {
-                    // Ask to confirm
-                    char* tempInfo = (char*) malloc(150);
-                    int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                    tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                    if (!sendData(playerIndex, tempInfo)) {
-                        printf("\nError while sending the advice!");
-                    }
-                    
-                    free(tempInfo);
-
-                    // Wait the user to continue
-                    requestInput(playerIndex);
-                }
-
-                break;
-        }
-    
-    } while (TRUE);
-
-    return;
-}
-
-static void giveObjects(int playerIndex, int currentTurn) {
-    // Check that there's more than one player
-    if (playerCount == 1) {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printColored("\nYou can't trade with yourself!", YELLOW);
-        } else {
-            char* info = (char*) malloc(125);
-            int size = sprintf(info, "%s\nYou can't trade with yourself!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-        return;
-    }
-
-    do {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            // Regex to clear the terminal.
-            printf("\e[1;1H\e[2J");
-            printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            printColored("\n------------- GIVABLE OBJECTS -------------\n", MAGENTA);
-
-        } else {
-            char* info = (char*) malloc(250);
-            int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- GIVABLE OBJECTS -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-
-        // Show the objects that can be traded
-        for (int i = 0; i < 4; i++) {
-            if ((players[playerIndex] -> backpack[i] != EMPTY_SLOT)) {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("\n%d) Give the %s", i + 1, objectsNames[players[playerIndex] -> backpack[i]]);
-                } else {
-                    char* info = (char*) malloc(250);
-                    int size = sprintf(info, "\n%d) Give the %s", i + 1, objectsNames[players[playerIndex] -> backpack[i]]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-            }
-        }
-
-        int choice;
-
-        if (!playerIndex) {        
-            // Add an option to exit the menu
-            printf("\n5) Exit the menu.");
-            printf("\nChoose from the option above: ");
-            scanf("%d", &choice);
-        } else {
-            // Ask to confirm
-            if (!sendData(playerIndex, "\n5) Exit the menu.\nChoose from the option above: ")) {
-                printf("\nError while sending the advice!");
-            }
-
-            // Wait the user input
-            char* userInput = requestInput(playerIndex);
-
-            choice = atoi(userInput);
-
-            free(userInput);
-        }
-
-
-        // Check if the input is valid
-        if ((1 > choice) || (choice > 5)) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printColored("\nError: please insert a valid input!", RED);
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-                
-                // Ask to confirm
-                char* tempInfo = (char*) malloc(150);
-                int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                if (!sendData(playerIndex, tempInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-
-                free(tempInfo);
-
-                // Wait the user to continue
-                requestInput(playerIndex);
-            }
-
-            continue;
-        } 
-        
-        unsigned char selectedObject = players[playerIndex] -> backpack[choice  - 1];
-
-        if (choice == 5) {
-            return;
-        } else {
-            // Check that the selected object is valid
-            if (selectedObject == EMPTY_SLOT) {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printColored("\nError: please insert a valid input!", RED);
-
-                    {
-                        // Clean the stdin
-                        char c;
-                        while ((c = getc(stdin)) != EOF) {
-                            if (c == '\n'){
-                                break;
-                            }
-                        }
-
-                        char confirm;
-                        printColored("\n\nPress ENTER to continue: ", YELLOW);
-                        scanf("%c", &confirm);
-                    }
-
-                } else {
-                    char* info = (char*) malloc(125);
-                    int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-
-                    // Ask to confirm
-                    char* tempInfo = (char*) malloc(150);
-                    int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                    tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                    if (!sendData(playerIndex, tempInfo)) {
-                        printf("\nError while sending the advice!");
-                    }
-
-                    free(tempInfo);
-
-                    // Wait the user to continue
-                    requestInput(playerIndex);
-                }
-
-                continue;
-            }
-
-            ZoneType currentZone = players[playerIndex] -> position -> zone;
-
-            do {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    // Regex to clear the terminal.
-                    printf("\e[1;1H\e[2J");
-                    printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                    printColored("\n------------- AVAILABLE PLAYERS -------------\n", MAGENTA);
-
-                } else {
-                    char* info = (char*) malloc(350);
-                    int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- AVAILABLE PLAYERS -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-
-                unsigned char availablesPlayers[] = {7, 7, 7, 7};
-                for (int i = 0; i < playerCount; i++) {
-                    // Check if the player has been eliminated
-                    if (players[i] == NULL) {
-                        continue;
-                    }
-
-                    if ((i != playerIndex) && ((players[i] -> position -> zone) == currentZone)) {
-                        // Send the info if is not the game master
-                        if (playerIndex == 0) {
-                            printf("\n%d) Give the %s to %s;", i + 1, objectsNames[selectedObject], players[i] -> playerName);
-                        } else {
-                            char* info = (char*) malloc(250);
-                            int size = sprintf(info, "\n%d) Give the %s to %s;", i + 1, objectsNames[selectedObject], players[i] -> playerName);
-                            info = (char*) realloc(info, size + 1);
-                            if (!sendData(playerIndex, info)) {
-                                printf("\nError while sending the info!");
-                            }
-                            free(info);
-                        }
-                        availablesPlayers[i] = i;
-                    }
-                }
-
-                int option;
-
-                if (!playerIndex) {        
-                    // Add an option to exit the menu
-                    printf("\n5) Exit the menu.");
-                    printf("\nChoose from the option above: ");                    
-                    scanf("%d", &option);
-
-                } else {
-                    // Ask to confirm
-                    if (!sendData(playerIndex, "\n5) Exit the menu.\nChoose from the option above: ")) {
-                        printf("\nError while sending the advice!");
-                    }
-                    // Wait the user input
-                    char* userInput = requestInput(playerIndex);
-
-                    option = atoi(userInput);
-
-                    free(userInput);
-                }
-
-                // Check if the input is valid
-                if ((1 > option) || (option > 5)) {
-                    // Send the info if is not the game master
-                    if (playerIndex == 0) {
-                        printColored("\nError: please insert a valid input!", RED);
-                        {
-                            // Clean the stdin
-                            char c;
-                            while ((c = getc(stdin)) != EOF) {
-                                if (c == '\n'){
-                                    break;
-                                }
-                            }
-
-                            char confirm;
-                            printColored("\n\nPress ENTER to continue: ", YELLOW);
-                            scanf("%c", &confirm);
-                        }
-                    } else {
-                        char* info = (char*) malloc(125);
-                        int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                        info = (char*) realloc(info, size + 1);
-                        if (!sendData(playerIndex, info)) {
-                            printf("\nError while sending the info!");
-                        }
-                        free(info);
-
-                        // Ask to confirm
-                        char* tempInfo = (char*) malloc(150);
-                        int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                        tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                        if (!sendData(playerIndex, tempInfo)) {
-                            printf("\nError while sending the advice!");
-                        }
-
-                        free(tempInfo);
-
-                        // Wait the user to continue
-                        requestInput(playerIndex);
-                    }
-
-                    continue;
-                }
-                
-                unsigned char selectedPlayer = availablesPlayers[option - 1];
-                
-                if (option == 5) {
-                    break;
-                } else if (selectedPlayer != 7) {
-                    for (int index = 0; index < 4; index++) {
-                        if ((players[selectedPlayer] -> backpack[index]) == EMPTY_SLOT) {
-                            players[selectedPlayer] -> backpack[index] = selectedObject;
-                            players[playerIndex] -> backpack[choice  - 1] = EMPTY_SLOT;
-                            
-                            // Send the info if is not the game master
-                            if (playerIndex == 0) {
-                                printf("%s\nYou gave the %s to %s%s", colorsCodes[MAGENTA], objectsNames[selectedObject], players[selectedPlayer] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                            } else {
-                                char* info = (char*) malloc(250);
-                                int size = sprintf(info, "%s\nYou gave the %s to %s%s", colorsCodes[MAGENTA], objectsNames[selectedObject], players[selectedPlayer] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                                info = (char*) realloc(info, size + 1);
-                                if (!sendData(playerIndex, info)) {
-                                    printf("\nError while sending the info!");
-                                }
-                                free(info);
-                            }
-                            return;
-                        }
-                    }
-                    
-                    // Send the info if is not the game master
-                    if (playerIndex == 0) {
-                        printColored("\nThe selected player hasn't empty slots!", YELLOW);
-
-                        {
-                            // Clean the stdin
-                            char c;
-                            while ((c = getc(stdin)) != EOF) {
-                                if (c == '\n'){
-                                    break;
-                                }
-                            }
-
-                            char confirm;
-                            printColored("\n\nPress ENTER to continue: ", YELLOW);
-                            scanf("%c", &confirm);
-                        }
-
-                    } else {
-                        char* info = (char*) malloc(125);
-                        int size = sprintf(info, "%s\nThe selected player hasn't empty slots!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                        info = (char*) realloc(info, size + 1);
-                        if (!sendData(playerIndex, info)) {
-                            printf("\nError while sending the info!");
-                        }
-                        free(info);
-
-                        // Ask to confirm
-                        char* tempInfo = (char*) malloc(150);
-                        int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                        tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                        if (!sendData(playerIndex, tempInfo)) {
-                            printf("\nError while sending the advice!");
-                        }
-
-                        free(tempInfo);
-
-                        // Wait the user to continue
-                        requestInput(playerIndex);
-                    }
-
-                } else {
-                    // Send the info if is not the game master
-                    if (playerIndex == 0) {
-                        printColored("\nError: please insert a valid input!", RED);
-
-                        {
-                            // Clean the stdin
-                            char c;
-                            while ((c = getc(stdin)) != EOF) {
-                                if (c == '\n'){
-                                    break;
-                                }
-                            }
-
-                            char confirm;
-                            printColored("\n\nPress ENTER to continue: ", YELLOW);
-                            scanf("%c", &confirm);
-                        }
-
-                    } else {
-                        char* info = (char*) malloc(125);
-                        int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                        info = (char*) realloc(info, size + 1);
-                        if (!sendData(playerIndex, info)) {
-                            printf("\nError while sending the info!");
-                        }
-                        free(info);
-
-                        // Ask to confirm
-                        char* tempInfo = (char*) malloc(150);
-                        int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                        tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                        if (!sendData(playerIndex, tempInfo)) {
-                            printf("\nError while sending the advice!");
-                        }
-
-                        free(tempInfo);
-
-                        // Wait the user to continue
-                        requestInput(playerIndex);
-                    }
-                }
-
-            } while (TRUE);
-        }
-
-    } while(TRUE);
-
-    return;
-}
-
-static void removeObject(int playerIndex, int currentTurn) {
-    do {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            // Regex to clear the terminal.
-            printf("\e[1;1H\e[2J");
-            printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            printColored("\n------------- REMOVABLE OBJECTS -------------\n", MAGENTA);
-
-        } else {
-            char* info = (char*) malloc(250);
-            int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- REMOVABLE OBJECTS -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-
-        // Show the objects that can be removed
-        for (int i = 0; i < 4; i++) {
-            if ((players[playerIndex] -> backpack[i] != EMPTY_SLOT)) {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("\n%d) Remove the %s", i + 1, objectsNames[players[playerIndex] -> backpack[i]]);
-                } else {
-                    char* info = (char*) malloc(250);
-                    int size = sprintf(info, "\n%d) Remove the %s", i + 1, objectsNames[players[playerIndex] -> backpack[i]]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-            }
-        }
-
-        int choice;
-
-        if (!playerIndex) {        
-            // Add an option to exit the menu
-            printf("\n5) Exit the menu.");
-            printf("\nChoose from the option above: ");            
-            scanf("%d", &choice);
-        } else {
-            // Ask to confirm
-            if (!sendData(playerIndex, "\n5) Exit the menu.\nChoose from the option above: ")) {
-                printf("\nError while sending the advice!");
-            }
-
-            // Wait the user input
-            char* userInput = requestInput(playerIndex);
-
-            choice = atoi(userInput);
-
-            free(userInput);
-        }
-
-        // Check if the input is valid
-        if ((1 > choice) || (choice > 5)) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printColored("\nError: please insert a valid input!", RED);
-
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-
-                // Ask to confirm
-                char* tempInfo = (char*) malloc(150);
-                int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                if (!sendData(playerIndex, tempInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-
-                free(tempInfo);
-
-                // Wait the user to continue
-                requestInput(playerIndex);
-            }
-            continue;
-        } 
-        
-        unsigned char selectedObject = players[playerIndex] -> backpack[choice  - 1];
-
-        if (choice == 5) {
-            return;
-        } else {
-            // Check that the selected object is valid
-            if (selectedObject == EMPTY_SLOT) {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printColored("\nError: please insert a valid input!", RED);
-
-                    {
-                        // Clean the stdin
-                        char c;
-                        while ((c = getc(stdin)) != EOF) {
-                            if (c == '\n'){
-                                break;
-                            }
-                        }
-
-                        char confirm;
-                        printColored("\n\nPress ENTER to continue: ", YELLOW);
-                        scanf("%c", &confirm);
-                    }
-
-                } else {
-                    char* info = (char*) malloc(125);
-                    int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-
-                    // Ask to confirm
-                    char* tempInfo = (char*) malloc(150);
-                    int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                    tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                    if (!sendData(playerIndex, tempInfo)) {
-                        printf("\nError while sending the advice!");
-                    }
-
-                    free(tempInfo);
-
-                    // Wait the user to continue
-                    requestInput(playerIndex);
-                }
-                continue;
-            }
-            
-            // Remove the object
-            players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
-            
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("%s\nYou have removed the %s from the backpack!%s", colorsCodes[MAGENTA], objectsNames[players[playerIndex] -> backpack[choice - 1]], colorsCodes[DEFAULT_COLOR]);
-            } else {
-                char* info = (char*) malloc(250);
-                int size = sprintf(info, "%s\nYou have removed the %s from the backpack!%s", colorsCodes[MAGENTA], objectsNames[players[playerIndex] -> backpack[choice - 1]], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-            return;
-        }
-
-    } while (TRUE);
-    
-    return;
-}
-
-static void reorginizeBackpack(int playerIndex, int currentTurn) {
-    do {
-        int emptySlots = 0;
-        
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            // Regex to clear the terminal.
-            printf("\e[1;1H\e[2J");
-            printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            printColored("\n------------- BACKPACK SLOTS -------------\n", MAGENTA);
-
-        } else {
-            char* info = (char*) malloc(250);
-            int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- BACKPACK SLOTS -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-
-        for (int i = 0; i < 4; i++) {
-            unsigned char slot = players[playerIndex] -> backpack[i];
-
-            // Count the number of empty slots
-            if (slot == EMPTY_SLOT) {
-                emptySlots++;
-            }
-            
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("\n%d) %s;", i + 1, objectsNames[slot]);
-            } else {
-                char* info = (char*) malloc(250);
-                int size = sprintf(info, "\n%d) %s;", i + 1, objectsNames[slot]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-        }
-
-        // Check that at least one slot is used
-        if (emptySlots == 4) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printColored("\nAll the slots are empty, there's nothing to reorginize!", YELLOW);
-            } else {
-                char* info = (char*) malloc(250);
-                int size = sprintf(info, "%s\nAll the slots are empty, there's nothing to reorginize!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-            return;
-        }
-
-        int choice;
-
-        if (!playerIndex) {        
-            // Add an option to exit the menu
-            printf("\n5) Exit the menu.");
-            printf("\nInsert the number of the slot to swap: ");            
-            scanf("%d", &choice);
-        } else {
-            // Ask to confirm
-            if (!sendData(playerIndex, "\n5) Exit the menu.\nInsert the number of the slot to swap: ")) {
-                printf("\nError while sending the advice!");
-            }
-
-            // Wait the user input
-            char* userInput = requestInput(playerIndex);
-
-            choice = atoi(userInput);
-
-            free(userInput);
-        }
-
-
-        // Check for invalid input
-        if ((1 > choice) || (choice > 5)) {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printColored("\nError: please insert a valid input!", RED);
-
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-
-            } else {
-                char* info = (char*) malloc(125);
-                int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-
-                // Ask to confirm
-                char* tempInfo = (char*) malloc(150);
-                int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                if (!sendData(playerIndex, tempInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-
-                free(tempInfo);
-
-                // Wait the user to continue
-                requestInput(playerIndex);
-            }
-
-            continue;
-        } else if (choice == 5) {
-            return;
-        }
-
-        unsigned char slotToSwap = players[playerIndex] -> backpack[choice - 1];
-
-        // Ask the player which slot to swap with the one selected before
-        do {
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                // Regex to clear the terminal.
-                printf("\e[1;1H\e[2J");
-                printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                printColored("\n------------- BACKPACK SLOTS -------------\n", MAGENTA);
-
-            } else {
-                char* info = (char*) malloc(250);
-                int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- BACKPACK SLOTS -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-            
-            // Show all the object in the backpack except the one selected before
-            for (int i = 0; i < 4; i++) {
-                if (i == (choice - 1)) {
-                    continue;
-                }
-
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printf("\n%d) %s;", i + 1, objectsNames[players[playerIndex] -> backpack[i]]);
-                } else {
-                    char* info = (char*) malloc(250);
-                    int size = sprintf(info, "\n%d) %s;", i + 1, objectsNames[players[playerIndex] -> backpack[i]]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-                }
-            }
-
-            int option;
-
-            if (!playerIndex) {        
-                // Add an option to exit the menu
-                printf("\n5) Exit the menu.");
-                printf("\nInsert the number of the slot to swap with the %s: ", objectsNames[slotToSwap]);
-                scanf("%d", &option);
-            } else {
-                // Ask to confirm
-                char* subMenuInfo = (char*) malloc(150);
-                int infoSize = sprintf(subMenuInfo, "\n5) Exit the menu.\nInsert the number of the slot to swap with the %s: ", objectsNames[slotToSwap]);
-                subMenuInfo = (char*) realloc(subMenuInfo, infoSize + 1);
-                if (!sendData(playerIndex, subMenuInfo)) {
-                    printf("\nError while sending the advice!");
-                }
-
-                free(subMenuInfo);
-
-                // Wait the user input
-                char* userInput = requestInput(playerIndex);
-
-                option = atoi(userInput);
-
-                free(userInput);
-            }
-
-            // Check for invalid input
-            if ((1 > option) || (option > 5) || (option == choice)) {
-                // Send the info if is not the game master
-                if (playerIndex == 0) {
-                    printColored("\nError: please insert a valid input!", RED);
-
-                    {
-                        // Clean the stdin
-                        char c;
-                        while ((c = getc(stdin)) != EOF) {
-                            if (c == '\n'){
-                                break;
-                            }
-                        }
-
-                        char confirm;
-                        printColored("\n\nPress ENTER to continue: ", YELLOW);
-                        scanf("%c", &confirm);
-                    }
-
-                } else {
-                    char* info = (char*) malloc(125);
-                    int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                    info = (char*) realloc(info, size + 1);
-                    if (!sendData(playerIndex, info)) {
-                        printf("\nError while sending the info!");
-                    }
-                    free(info);
-
-                    // Ask to confirm
-                    char* tempInfo = (char*) malloc(150);
-                    int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-                    tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-                    if (!sendData(playerIndex, tempInfo)) {
-                        printf("\nError while sending the advice!");
-                    }
-
-                    free(tempInfo);
-
-                    // Wait the user to continue
-                    requestInput(playerIndex);
-                }
-                continue;
-            } else if (option == 5) {
-                break;
-            }
-
-            // Swap the selected slots
-            unsigned char selectedSlot = players[playerIndex] -> backpack[option - 1]; 
-            players[playerIndex] -> backpack[choice - 1] = selectedSlot;
-            players[playerIndex] -> backpack[option - 1] = slotToSwap;
-
-                        
-            // Send the info if is not the game master
-            if (playerIndex == 0) {
-                printf("%s\nSwapped the %s with the %s!%s", colorsCodes[MAGENTA], objectsNames[slotToSwap], objectsNames[selectedSlot], colorsCodes[DEFAULT_COLOR]);
-            } else {
-                char* info = (char*) malloc(250);
-                int size = sprintf(info, "%s\nSwapped the %s with the %s!%s", colorsCodes[MAGENTA], objectsNames[slotToSwap], objectsNames[selectedSlot], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(playerIndex, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-            return;
-
-        } while (TRUE);
-
-    } while (TRUE);
-
-    return;
-}
-
-static int randomNumber(int range) {
-    // Check if the current time has been already initialized
-    if (currentTime == 0) {
-        // Initialize the random number generator using the current time
-        srand((unsigned) time(&currentTime));
-    }
-
-    // Generate some numbers to increase the randomness
-    for (int i = 0; i < 10; i++) {
-        rand();
-    }
-
-    // Generate a random number and set it into the given range
-    return (rand() % range);
-}
-
-static void generateTurns() {
-    // Check if the turns array has been already used
-    if (turns != NULL) {
-        free(turns);
-        turns = NULL;
-    }
-
-    // Allocate the memory for the turns array
-    turns = (int*) calloc(playerCount, sizeof(int));
-
-    // Generate the players' turns
-    for (int i = 0; i < playerCount; i++) {
-        // Generate a random number
-        int randomNum = randomNumber(playerCount);
-        
-        for (int l = 0; l < i; l++) {
-            // If the generated number is already in the array, regenerate a new one and check it
-            if (turns[l] == randomNum) {
-                // Reset the counter of the for loop
-                l = -1;
-
-                // Generate a new random number
-                randomNum = randomNumber(playerCount);
-            }
-        }
-        
-        turns[i] = randomNum;
-    }
-
-    return;
-}
-
-static void checkGameStatus() {
-    // If all the three different type of evidence has been collected, then the players win
-    if ((caravanEvidence[0] != NO_EVIDENCE) && (caravanEvidence[1] != NO_EVIDENCE) && (caravanEvidence[2] != NO_EVIDENCE)) {
-        gameState = WIN;
-        return;
-    }
-
-    int playersEliminated = 0;
-    for (int i = 0; i < playerCount; i++) {
-        // If the mental health of the player is equal or less than 0, then eliminate the player
-        if ((players[i] -> mentalHealth) <= 0) {
-            free(players[i]);
-            players[i] = NULL;
-
-            if (i == 0) {
-                printColored("\nYou have been eliminated because your mental health is less than 0!", RED);
-                
-                {
-                    // Clean the stdin
-                    char c;
-                    while ((c = getc(stdin)) != EOF) {
-                        if (c == '\n'){
-                            break;
-                        }
-                    }
-
-                    char confirm;
-                    printColored("\n\nPress ENTER to continue: ", YELLOW);
-                    scanf("%c", &confirm);
-                }
-
-            } else {
-                char* info = (char*) malloc(150);
-                int size = sprintf(info, "%s\nYou have been eliminated because your mental health is less than 0!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
-                info = (char*) realloc(info, size + 1);
-                if (!sendData(i, info)) {
-                    printf("\nError while sending the info!");
-                }
-                free(info);
-            }
-
-            // Ask to confirm
-            char* tempInfo = (char*) malloc(150);
-            int tempInfoSize = sprintf(tempInfo, "\n%sPress ENTER to continue: %s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
-            tempInfo = (char*) realloc(tempInfo, tempInfoSize + 1);
-            if (!sendData(i, tempInfo)) {
-                printf("\nError while sending the advice!");
-            }
-
-            free(tempInfo);
-
-            // Wait the user to continue
-            requestInput(i);
-        
-        }
-
-        // Increment the counter for each player that has been eliminated
-        if (players[i] == NULL) {
-            playersEliminated++;
-        }
-    }
-
-    // If every player has been eliminated, then game over
-    if (playersEliminated == playerCount) {
-        gameState = GAME_OVER;
-        return;
-    }
-
-    return;
-}
-
-static char* printObjectsInfo(unsigned char objects[]) {
-    unsigned char duplicates[] = {0, 0, 0, 0};
-    int duplicateCount = 0;
-    int isDuplicated;
-    
-    for (int index = 0; index < 4; index++) {
-        // Skip the object if it's not valid
-        if ((4 > objects[index]) && (objects[index] > 9)) {
-            continue;
-        }
-
-        // Check for duplicates
-        isDuplicated = 0;
-        for (int i = 0; i < duplicateCount; i++) {
-            if (objects[index] == duplicates[i]) {
-                isDuplicated = 1;
-                break;
-            }
-        }
-
-        // If the current object is not a duplicate than print its effect
-        if (!isDuplicated) {
-            // Add the object to the duplicates
-            duplicates[duplicateCount] = objects[index];
-            duplicateCount++;
-
-            // Show the info of the object
-            switch (objects[index]) {
-                case 4:
-                    return "\n- Use the SEDATIVE to increase the mental health by 40 points";
-
-                case 5:
-                    return "\n- Use the SALT to prevent a decrement of the mental health, caused by the ghost";
-
-                case 6:
-                    return "\n- Use the ADRENALINE to go to the next zone and obtain an extra turn";
-
-                case 7:
-                    return "\n- Use the HUNDRED_DOLLAR to buy a TRANQUILLIZER or SALT";
-
-                case 8:
-                    return "\n- Use the KNIFE and if the mental health is under 30 kill all the players in the same zone as the current player";
-
-                case 9:
-                    return "\n- Use the TRANQUILLIZER to increase the mental health by 40 points";
-            }
-        }
-    }
-
-    return " ";
-}
-
-static void printEvidenceCollected(int playerIndex, int currentTurn) {
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-        printColored("\n------------- EVIDENCE COLLECTED IN THE CARAVAN -------------\n", MAGENTA);
-
-    } else {
-        char* info = (char*) malloc(250);
-        int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- EVIDENCE COLLECTED IN THE CARAVAN -------------\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-
-    for (int i = 0; i < 3; i++) {
-        // Send the info if is not the game master
-        if (playerIndex == 0) {
-            printf("\n%d) %s", i + 1, objectsNames[caravanEvidence[i]]);
-        } else {
-            char* info = (char*) malloc(250);
-            int size = sprintf(info, "\n%d) %s", i + 1, objectsNames[caravanEvidence[i]]);
-            info = (char*) realloc(info, size + 1);
-            if (!sendData(playerIndex, info)) {
-                printf("\nError while sending the info!");
-            }
-            free(info);
-        }
-    }
-    
-    return;
-}
-
-static void printGhostInfo(int playerIndex, int currentTurn) {
-    // Send the info if is not the game master
-    if (playerIndex == 0) {
-        // Regex to clear the terminal.
-        printf("\e[1;1H\e[2J");
-        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
-        printColored("\n------------- GHOST INFO -------------", MAGENTA);
-        printf("\nGhost position: %s", zoneTypeNames[ghostPosition]);
-        printf("\nGhost appeareance probability: %d%%", ghostAppearance);        
-
-    } else {
-        char* info = (char*) malloc(250);
-        int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n\n------------- GHOST INFO -------------\n%s\nGhost position: %s\nGhost appeareance probability: %d%%", colorsCodes[MAGENTA], (roundCount + 1), (currentTurn + 1), players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR], zoneTypeNames[ghostPosition], ghostAppearance);
-        info = (char*) realloc(info, size + 1);
-        if (!sendData(playerIndex, info)) {
-            printf("\nError while sending the info!");
-        }
-        free(info);
-    }
-
-    return;
-}
-
-static void printColored(char* str, ColorType color) {
-    printf("%s%s%s", colorsCodes[color], str, colorsCodes[DEFAULT_COLOR]);
-    return;
-}
-
-static char* printAdvices(int playerIndex) {
-    Player* player = players[playerIndex];
-    char* temp = (char*) malloc(375);
-    int currentLen = 0;
-
-    // Check if the player have an evidence to deposit
-    for (int i = 0; i < 4; i++) {
-        unsigned char slot = player -> backpack[i];
-        if ((slot >= 11) && (slot != EMPTY_SLOT)) {
-            currentLen = sprintf(temp, "ADVICE: Deposit the evidence in the caravan! (Type 1)");
-            temp = (char*) realloc(temp, currentLen + 1);            
-            return temp;
-        }
-    }    
-    
-    // Check if there's an evidence to pick
-    for (int i = 0; i < 4; i++) {
-        unsigned char slot = (player -> backpack[i]) + 10;
-        unsigned char currentEvidence = (player -> position -> evidence);
-        if ((currentEvidence == slot) && (slot != NO_EVIDENCE)) {
-            currentLen = sprintf(temp, "ADVICE: Pick the evidence from the current zone! (Type 3)");
-            temp = (char*) realloc(temp, currentLen + 1);
-            return temp;
-        }
-    }    
-    
-    // Check if the player have an object to use
-    for (int i = 0; i < 4; i++) {
-        unsigned char slot = player -> backpack[i];
-        if ((3 < slot) && (slot < 10)) {
-            currentLen = sprintf(temp, "ADVICE: Use an object from the backpack! (Type 5)");
-            temp = (char*) realloc(temp, currentLen + 1);
-            return temp;
-        }
-    }    
-    
-    // Check if there's an object to pick
-    for (int i = 0; i < 4; i++) {
-        unsigned char currentZoneObject = player -> position -> zoneObject;
-        if ((0 < currentZoneObject) && (currentZoneObject < 10)) {
-            currentLen = sprintf(temp, "ADVICE: Pick the object from the current zone! (Type 4)");
-            temp = (char*) realloc(temp, currentLen + 1);
-            return temp;
-        }
-    }    
-    
-    // Before checking if is better skip the turn, check if there's more than one player
-    if (playerCount > 1) {
-        // Check if there's a player in the same zone that has the object to pick the evidence from the current zone
-        for (int index = 0; index < playerCount; index++) {
-            // Don't evaluate the current player
-            if (index == playerIndex) {
-                continue;
-            }
-
-            ZoneType currentEvaluatedZone = player -> position -> zone;
-            if (currentEvaluatedZone != (players[index] -> position -> zone)) {
-                continue;
-            }
-
-            unsigned char currentZoneEvidence = (player -> position -> evidence);
-
-            for (int i = 0; i < 4; i++) {
-                // Add 10 to the current player object to verify if the objects match the corresponding evidence
-                unsigned char playerSlot = (players[index] -> backpack[i]) + 10;
-
-                if ((playerSlot == currentZoneEvidence) && (playerSlot != NO_EVIDENCE)) {
-                    currentLen = sprintf(temp, "ADVICE: Skip the turn, because %s has the object to pick the evidence from the current zone! (Type 6)", players[index] -> playerName);
-                    temp = (char*) realloc(temp, currentLen + 1);
-                    return temp;
-                }
-            }
-        }
-    }
-
-    // If there's nothing to do, advise to go to the next zone
-    currentLen = sprintf(temp, "ADVICE: Go to the next zone! (Type 2)");
-    temp = (char*) realloc(temp, currentLen + 1);
-    return temp;
-
-}
-
-/* END OF DEFINITIONS */
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "server.h"
+
+/* INTERNALS VARIABLES INITIALIZATION AND INTERNALS FUNCTIONS DECLARATION */
+
+static const char* zoneTypeNames[] = {"CARAVAN", "KITCHEN", "LIVING_ROOM", "ROOM", "BATHROOM", "GARAGE", "BASEMENT", "-"};
+static const char* objectsNames[] = {"-", "EMF", "SPIRIT_BOX", "CAMERA", "SEDATIVE", "SALT", "ADRENALINE", "HUNDRED_DOLLAR", "KNIFE", "TRANQUILLIZER", "NO_OBJECT", "EMF_EVIDENCE", "SPIRIT_BOX_EVIDENCE", "CAMERA_EVIDENCE", "NO_EVIDENCE", "EMPTY_SLOT"};
+static const char* difficultiesLevels[] = {"AMATEUR", "INTERMEDIATE", "NIGHTMARE"};
+static const char* colorsCodes[] = {"\x1b[1;30m", "\x1b[1;31m", "\x1b[1;32m", "\x1b[1;33m", "\x1b[1;34m", "\x1b[1;35m", "\x1b[1;36m", "\x1b[1;37m", "\x1b[1;0m"};
+static const int gameLevels[] = {15, 30, 50};
+
+typedef TurnStep (*turnStepHandler)(GameSession* session, char* input);
+
+/// @brief Insert a zone to the end of the list.
+/// @param session 
+static void insertZone(GameSession* session);
+
+/// @brief Delete the last zone.
+/// @param session 
+static void deleteZone(GameSession* session);
+
+/// @brief Show all the zones currently on the map to the game master.
+/// @param session 
+static void printZones(GameSession* session);
+
+/// @brief Return the zones of the map, from the first to the last one.
+/// @param session 
+/// @return Return the string of the map.
+static char* printMap(GameSession* session);
+
+/// @brief Show a text to the game master, in the terminal or on his client if the server is dedicated.
+/// @param session 
+/// @param text 
+/// @param color 
+static void tellMaster(GameSession* session, char* text, ColorType color);
+
+/// @brief Read a line written by the game master, in the terminal or on his client if the server is dedicated.
+/// @param session 
+/// @param answer 
+/// @param size 
+/// @return Return FALSE if the game master has left.
+static bool askMaster(GameSession* session, char* answer, int size);
+
+/// @brief Wait that the game master presses ENTER.
+/// @param session 
+/// @return Return FALSE if the game master has left.
+static bool confirmMaster(GameSession* session);
+
+/// @brief Tell the game master that the input isn't valid, and wait that he confirms.
+/// @param session 
+/// @return Return FALSE if the game master has left.
+static bool rejectSetting(GameSession* session);
+
+/// @brief Move the evidence from the player's backpack to the caravan, and set the player's position to the first zone.
+/// @param session 
+/// @param playerIndex 
+/// @return Return 1 if the player has an evidence, otherwise 0.
+static void goToCaravan(GameSession* session, int playerIndex);
+
+/// @brief Print the info of the given player.
+/// @param session 
+/// @param playerIndex 
+/// @param currentTurn 
+static void printPlayer(GameSession* session, int playerIndex, int currentTurn);
+
+/// @brief Print the info of the given zone.
+/// @param session 
+/// @param playerIndex
+/// @param currentTurn 
+static void printZone(GameSession* session, int playerIndex, int currentTurn);
+
+/// @brief Move the given player to the next zone.
+/// @param session 
+/// @param playerIndex 
+static void goToNextZone(GameSession* session, int playerIndex);
+
+/// @brief Pick an evidence from a zone if the player has the object to pick it.
+/// @param session 
+/// @param playerIndex 
+static void pickEvidence(GameSession* session, int playerIndex);
+
+/// @brief Try to pick the object from the current player's position.
+/// @param session 
+/// @param playerIndex 
+static void pickObject(GameSession* session, int playerIndex);
+
+
+
+
+
+/// @brief Generate a random number in a given range.
+/// @param session 
+/// @param range 
+/// @return Return a random number in the given range.
+static int randomNumber(GameSession* session, int range);
+
+/// @brief Generate the turns for a round.
+/// @param session 
+static void generateTurns(GameSession* session);
+
+
+/// @brief Print the info of the objects availables. 
+/// @param objects 
+static char* printObjectsInfo(unsigned char objects[]);
+
+/// @brief Print all the evidences that are in the caravan.
+/// @param session 
+/// @param playerIndex 
+/// @param currentTurn 
+static void printEvidenceCollected(GameSession* session, int playerIndex, int currentTurn);
+
+/// @brief Print the info about the ghost.
+/// @param session 
+/// @param playerIndex 
+/// @param currentTurn 
+static void printGhostInfo(GameSession* session, int playerIndex, int currentTurn);
+
+/// @brief Print using the given color.
+/// @param str 
+/// @param color 
+static void printColored(char* str, ColorType color);
+
+/// @brief Print the advice for the player.
+/// @param session 
+/// @param playerIndex
+static char* printAdvices(GameSession* session, int playerIndex);
+
+
+/// @brief Send to the player the fields of the game state that have changed since the last time, or all of them the first time.
+/// @param session 
+/// @param playerIndex 
+/// @param currentTurn 
+static void syncState(GameSession* session, int playerIndex, int currentTurn);
+
+/// @brief Make the player render one of the screens, using the game state.
+/// @param session 
+/// @param playerIndex 
+/// @param currentTurn 
+/// @param screen 
+static void showScreen(GameSession* session, int playerIndex, int currentTurn, gameScreen screen);
+
+/// @brief Park the session till the given player sends an input.
+/// @param session 
+/// @param playerIndex 
+static void awaitInput(GameSession* session, int playerIndex);
+
+/// @brief Ask the player to press ENTER, and park the session till he confirms.
+/// @param session 
+/// @param playerIndex 
+/// @param prompt The text of the catalog to send to the clients.
+static void awaitConfirm(GameSession* session, int playerIndex, catalogMessage prompt);
+
+/// @brief Tell the player that the input isn't valid, and park the session till he confirms.
+/// @param session 
+/// @param playerIndex 
+static void rejectInput(GameSession* session, int playerIndex);
+
+/// @brief Print the banner of the current turn in the terminal of the game master.
+/// @param session 
+/// @param title The title of the screen, or NULL.
+static void printTurnHeader(GameSession* session, char* title);
+
+/// @brief Close the current action and go back to the actions menu, once the player has read the result.
+/// @param session 
+/// @return Return the step of the actions menu.
+static TurnStep endAction(GameSession* session);
+
+/// @brief Generate the turns of a new round.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep startRound(GameSession* session, char* input);
+
+/// @brief Tell every player whose turn is, or go to the next round.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep startTurn(GameSession* session, char* input);
+
+/// @brief Check if the players win or lose, and eliminate the players without mental health.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep checkGameStatus(GameSession* session, char* input);
+
+/// @brief Show the actions that the current player can do.
+/// @param session 
+static void showActionMenu(GameSession* session);
+
+/// @brief Show the actions menu, and perform the action chosen by the player.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep chooseAction(GameSession* session, char* input);
+
+/// @brief Use an object from the availables in the backpack. 
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep useObject(GameSession* session, char* input);
+
+/// @brief Buy an object with the HUNDRED_DOLLAR selected before.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep buyObject(GameSession* session, char* input);
+
+/// @brief Choose an object to give to another player.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep giveObjects(GameSession* session, char* input);
+
+/// @brief Give the object selected before to another player in the same zone.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep giveObjectTo(GameSession* session, char* input);
+
+/// @brief Remove an object from the player's backpack.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep removeObject(GameSession* session, char* input);
+
+/// @brief Let the user choose the slot of the backpack to move.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep reorginizeBackpack(GameSession* session, char* input);
+
+/// @brief Swap the slot selected before with another one.
+/// @param session 
+/// @param input The input of the player, or NULL to show the menu.
+/// @return Return the next step.
+static TurnStep swapSlots(GameSession* session, char* input);
+
+/// @brief Decrease randomly the mental health of the player, then wait that he confirms the end of the turn.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep endTurn(GameSession* session, char* input);
+
+/// @brief Tell every player that the turn has ended.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep closeTurn(GameSession* session, char* input);
+
+/// @brief Tell every player the result of the game.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep endGame(GameSession* session, char* input);
+
+/// @brief Deallocate the game once the game master has read the result.
+/// @param session 
+/// @param input 
+/// @return Return the next step.
+static TurnStep closeSession(GameSession* session, char* input);
+
+/// @brief Run the steps of the game till one of them has to wait for a player, must be called with the lock of the session.
+/// @param session 
+/// @param input The input that the session was waiting for, or NULL.
+static void advanceGame(GameSession* session, char* input);
+
+/// @brief Resume the session with the input of a client, called by the worker of the room.
+/// @param context The session.
+/// @param clientIndex 
+/// @param message 
+/// @return Return TRUE, the session takes every message.
+static bool receiveInput(void* context, int clientIndex, dataReceived message);
+
+/* END OF INITIALIZATIONS AND DECLARATIONS */
+
+int choosePlayersCount(GameSession* session) {
+    char answer[64];
+
+    do {
+        // Regex to clear the terminal.
+        tellMaster(session, "\e[1;1H\e[2J", DEFAULT_COLOR);
+
+        tellMaster(session, "\n------------- NEW ROOM -------------\n", MAGENTA);
+        tellMaster(session, "\nHow many players will join the room, you included? (MAX 3): ", DEFAULT_COLOR);
+        if (!askMaster(session, answer, sizeof(answer))) {
+            return 0;
+        }
+
+        // Check if the number of players is valid
+        int playersCount = atoi(answer);
+        if ((1 <= playersCount) && (playersCount <= MAX_CLIENTS)) {
+            return playersCount;
+        }
+
+        if (!rejectSetting(session)) {
+            return 0;
+        }
+
+    } while (TRUE);
+}
+
+bool set(GameSession* session, int playerNum) {
+    char answer[64];
+
+    // Reset the current time
+    session -> currentTime = 0;
+
+    // Set the global variable player count
+    session -> playerCount = playerNum;
+
+    // Allocate the space for the players
+    session -> players = (Player**) calloc(session -> playerCount, sizeof(Player*));
+
+    // Request the difficulty level
+    do {
+        // Regex to clear the terminal.
+        tellMaster(session, "\e[1;1H\e[2J", DEFAULT_COLOR);
+        
+        tellMaster(session, "\n------------- DIFFICULTY LEVELS -------------\n", MAGENTA);
+        tellMaster(session, "\n1) Amateur;\n2) Intermediate;\n3) Nightmare.\nChoose the difficulty level from the option above: ", DEFAULT_COLOR);
+        if (!askMaster(session, answer, sizeof(answer))) {
+            return FALSE;
+        }
+
+        // Check if the game level selected is valid
+        session -> gameLevel = atoi(answer);
+        if ((1 <= session -> gameLevel) && (session -> gameLevel <= 3)) {
+            session -> gameLevel--;
+            break;
+        }
+
+        if (!rejectSetting(session)) {
+            return FALSE;
+        }
+
+    } while (TRUE);
+    
+    // Generate the game map
+    do {
+        // Regex to clear the terminal.
+        tellMaster(session, "\e[1;1H\e[2J", DEFAULT_COLOR);
+
+        tellMaster(session, "\n------------- MAP EDITOR -------------\n", MAGENTA);
+        tellMaster(session, "\n1) Insert a new zone;\n2) Delete the last zone;\n3) Print the zones currently on the map;\n4) Close the map.\nChoose between the option listed above: ", DEFAULT_COLOR);
+        if (!askMaster(session, answer, sizeof(answer))) {
+            return FALSE;
+        }
+
+        switch (atoi(answer)) {
+            case 1: 
+                insertZone(session);
+                printZones(session);
+                break;   
+
+            case 2: 
+                // Check if there's a zone to delete
+                if (session -> firstZone == NULL) {
+                    tellMaster(session, "\nThe map is already empty!", YELLOW);
+                    break;
+                }
+
+                deleteZone(session);
+                printZones(session);
+                break;            
+            
+            case 3: 
+                printZones(session);
+                break;
+
+            case 4:
+                // Check if the map has been set
+                if (session -> firstZone != NULL) {
+                    return TRUE;
+                }
+
+                tellMaster(session, "\nBefore closing the map, set at least one zone!", RED);
+                break;
+
+            default:
+                if (!rejectSetting(session)) {
+                    return FALSE;
+                }
+                continue;
+        }
+
+        // Let the game master read the result before showing the editor again
+        if (!confirmMaster(session)) {
+            return FALSE;
+        }
+
+    } while (TRUE);
+}
+
+void setPlayers(GameSession* session, int playerIndex, char* info) {
+    // Allocate the space in the heap for the player struct
+    Player* player = (Player*) malloc(sizeof(Player));
+
+    // Initialize the player mental health to 100
+    player -> mentalHealth = 100;
+
+    // If the player is the game master ask the name and the useadvice
+    if (playerIndex == 0) {
+        // Regex to clear the terminal.
+        printf("\e[1;1H\e[2J");
+        
+        printColored("\n------------- PLAYER INFO -------------\n", MAGENTA);
+
+        // Allocate the space for the player's name
+        player -> playerName = (char*) malloc(225);
+    
+        // Get the player's name
+        do {
+            printf("\nInsert the name of the player %s (MAX 225 characters)%s: ", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
+
+            // Check if the input string contains the newline character
+            char *temp;
+            if ((temp = strchr(fgets((player -> playerName), 225, stdin), '\n')) != NULL) {
+                // Change the newline with the string terminator
+                *temp = '\0';
+
+                // Resize the size of the name array
+                player -> playerName = (char*) realloc(player -> playerName, strlen(player -> playerName) + 1);
+            } else {
+                // If the input string doesn't contain the newline than clean the stdin
+                char c;
+                while((c = getc(stdin)) != EOF) {
+                    if(c == '\n') {
+                        break;          
+                    }
+                }
+
+                // Change the newline with the string terminator
+                *temp = '\0';
+            }
+            
+            // Check if the given input string is empty or not
+            int isEmpty = 1;
+            for (int i = 0; player -> playerName[i] != '\0'; i++) {
+                if ((player -> playerName[i] != ' ')) {
+                    isEmpty = 0;
+                    break;
+                }
+            }
+
+            if (isEmpty) {
+                printColored("\nError: please insert a valid input!\n", RED);
+                continue;
+            } else {
+                break;
+            }
+
+        } while (TRUE);
+
+        // Ask if the player wants advice during the game
+        do {
+            char confirm;
+            printColored("\nDo you want to receive advices during the game? (Y/N): ", YELLOW);
+            scanf("%c", &confirm);
+
+            if (confirm == 'Y') {
+                player -> useAdvices = ACTIVE;
+                break;
+            } else if (confirm == 'N') {
+                player -> useAdvices = INACTIVE;
+                break;
+            }
+
+            printColored("\nError: please insert a valid input!\n", RED);
+
+        } while (TRUE);
+
+        {
+            // Clean the stdin
+            char c;
+            while ((c = getc(stdin)) != EOF) {
+                if (c == '\n'){
+                    break;
+                }
+            }
+
+            char confirm;
+            printColored("\n\nPress ENTER to continue: ", YELLOW);
+            scanf("%c", &confirm);
+        }
+
+
+    } else {
+        // Allocate the space for the player's name and load the name
+        int index;
+        player -> playerName = (char*) malloc(225);
+        for (index = 0; info[index] != '>'; index++) {
+            player -> playerName[index] = info[index];
+        }
+
+        player -> playerName[index] = '\0';
+        player -> playerName = (char*) realloc(player -> playerName, index);
+
+        // Set if the player uses advices
+        player -> useAdvices = (info[index + 1] == 'Y');
+    }
+
+    // Generate a random object for the player
+    player -> backpack[0] = randomNumber(session, 5) + 1;
+
+    // Set the backpack's slots as empty
+    for (int i = 1; i < 4; i++) {
+        player -> backpack[i] = EMPTY_SLOT;
+    }
+
+    // Set the state of the salt protection to inactive
+    player -> saltProtection = INACTIVE;
+
+    // Set the player's position to the first zone
+    player -> position = session -> firstZone;
+
+    // Add the player to the players array
+    session -> players[playerIndex] = player;
+
+    return;
+}
+
+char* showGameSettings(GameSession* session) {
+    char* map = printMap(session);
+    char* result = (char*) malloc(2500 + strlen(map));
+    int currentLen = 0;
+
+    // Show the current settings
+    currentLen += sprintf(result + currentLen, "%s\n------------- GAME SETTINGS -------------\n%s", colorsCodes[MAGENTA], colorsCodes[DEFAULT_COLOR]);
+
+    currentLen += sprintf(result + currentLen, "\nNumber of players: %d - (", session -> playerCount - session -> firstPlayer);
+
+    for (int i = session -> firstPlayer; i < session -> playerCount; i++) {
+        currentLen += sprintf(result + currentLen, "%s%s", session -> players[i] -> playerName, i != (session -> playerCount - 1) ? ", " : ")");
+    }
+    
+    currentLen += sprintf(result + currentLen, "\nGame difficulty: %s\n", difficultiesLevels[session -> gameLevel]);
+
+    currentLen += sprintf(result + currentLen, "%s\n------------- CURRENT MAP -------------\n%s", colorsCodes[CYAN], colorsCodes[DEFAULT_COLOR]);
+
+    currentLen += sprintf(result + currentLen, "%s", map);
+    free(map);
+    
+    result = (char*) realloc(result, currentLen + 1);
+
+    return result;
+}
+
+bool confirmGameSettings(GameSession* session, char* settings) {
+    // Regex to clear the terminal.
+    tellMaster(session, "\e[1;1H\e[2J", DEFAULT_COLOR);
+
+    tellMaster(session, settings, DEFAULT_COLOR);
+
+    return confirmMaster(session);
+}
+
+void resetData(GameSession* session) {
+    // Set to zero all the variables
+    session -> roundCount = 0;
+    for (int i = 0; i < 3; i++) {
+        session -> snapshotsSent[i] = FALSE;
+    }
+    session -> ghostPosition = NO_ZONE;
+    session -> ghostAppearance = gameLevels[session -> gameLevel];
+    for (int i = 0; i < 3; i++) {
+        session -> caravanEvidence[i] = NO_EVIDENCE;
+    }
+
+    // Deallocate the turns if already used
+    if (session -> turns != NULL) {
+        free(session -> turns);
+        session -> turns = NULL;
+    }
+
+    return;
+}
+
+static void syncState(GameSession* session, int playerIndex, int currentTurn) {
+    Player* player = session -> players[playerIndex];
+    unsigned short* sentState = session -> sentStates[playerIndex - 1];
+    unsigned short state[STATE_FIELDS_COUNT];
+    char payload[STATE_FIELDS_COUNT * STATE_ENTRY_SIZE];
+    int payloadLen = 0;
+
+    // Collect the state as the player sees it
+    state[STATE_ROUND] = session -> roundCount + 1;
+    state[STATE_TURN] = currentTurn + 1;
+    state[STATE_MENTAL_HEALTH] = player -> mentalHealth;
+    state[STATE_POSITION] = player -> position -> zone;
+    state[STATE_ZONE_EVIDENCE] = player -> position -> evidence;
+    state[STATE_ZONE_OBJECT] = player -> position -> zoneObject;
+    state[STATE_NEXT_ZONE] = player -> position -> nextZone -> zone;
+    state[STATE_USE_ADVICES] = player -> useAdvices;
+    state[STATE_SALT_PROTECTION] = player -> saltProtection;
+    state[STATE_GHOST_POSITION] = session -> ghostPosition;
+    state[STATE_GHOST_APPEARANCE] = session -> ghostAppearance;
+    for (int i = 0; i < 4; i++) {
+        state[STATE_BACKPACK + i] = player -> backpack[i];
+    }
+    for (int i = 0; i < 3; i++) {
+        state[STATE_CARAVAN_EVIDENCE + i] = session -> caravanEvidence[i];
+    }
+
+    // Add only the fields that the player doesn't know yet
+    bool snapshot = !session -> snapshotsSent[playerIndex - 1];
+    for (int i = 0; i < STATE_FIELDS_COUNT; i++) {
+        if (snapshot || (state[i] != sentState[i])) {
+            encodeStateEntry(payload + payloadLen, i, state[i]);
+            payloadLen += STATE_ENTRY_SIZE;
+        }
+    }
+
+    if (payloadLen == 0) {
+        return;
+    }
+
+    if (!sendFlaggedMessage(session -> room, playerIndex, OP_STATE, snapshot ? STATE_SNAPSHOT : NO_FLAGS, payload, payloadLen)) {
+        printf("\nError while sending the game state!");
+        return;
+    }
+
+    memcpy(sentState, state, sizeof(state));
+    session -> snapshotsSent[playerIndex - 1] = TRUE;
+
+    return;
+}
+
+static void showScreen(GameSession* session, int playerIndex, int currentTurn, gameScreen screen) {
+    char screenId = screen;
+
+    // Be sure that the player has the latest state before rendering
+    syncState(session, playerIndex, currentTurn);
+
+    if (!sendMessage(session -> room, playerIndex, OP_SCREEN, &screenId, 1)) {
+        printf("\nError while sending the info!");
+    }
+
+    return;
+}
+
+static void awaitInput(GameSession* session, int playerIndex) {
+    // Ask the client to send an input, the game master writes it in the terminal
+    if ((playerIndex != 0) && !sendMessage(session -> room, playerIndex, OP_USER_INPUT, NULL, 0)) {
+        printf("\nError while sending the input request!");
+    }
+
+    session -> awaitingPlayer = playerIndex;
+
+    return;
+}
+
+static void awaitConfirm(GameSession* session, int playerIndex, catalogMessage prompt) {
+    if (playerIndex == 0) {
+        printColored("\n\nPress ENTER to continue: ", YELLOW);
+    } else if (!sendCatalog(session -> room, playerIndex, prompt)) {
+        printf("\nError while sending the advice!");
+    }
+
+    awaitInput(session, playerIndex);
+    session -> confirming = TRUE;
+
+    return;
+}
+
+static void rejectInput(GameSession* session, int playerIndex) {
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printColored("\nError: please insert a valid input!", RED);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_INVALID_INPUT)) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    awaitConfirm(session, playerIndex, MSG_PRESS_ENTER);
+
+    return;
+}
+
+static void printTurnHeader(GameSession* session, char* title) {
+    // Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+
+    printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[session -> playerTurn] -> playerName, colorsCodes[DEFAULT_COLOR]);
+
+    if (title != NULL) {
+        printColored(title, MAGENTA);
+    }
+
+    return;
+}
+
+static TurnStep endAction(GameSession* session) {
+    int playerTurn = session -> playerTurn;
+
+    // Send to the player what the action has changed
+    if (playerTurn != 0) {
+        syncState(session, playerTurn, session -> turnIndex);
+    }
+
+    // Before showing the actions again wait that the player confirms that has read the result
+    awaitConfirm(session, playerTurn, MSG_PRESS_ENTER);
+
+    return STEP_ACTION;
+}
+
+static TurnStep startRound(GameSession* session, char* input) {
+    // Generate the turns for this round
+    generateTurns(session);
+    session -> turnIndex = 0;
+
+    return STEP_TURN_START;
+}
+
+static TurnStep startTurn(GameSession* session, char* input) {
+    // Go to the next round when every player has played
+    if (session -> turnIndex == (session -> playerCount - session -> firstPlayer)) {
+        session -> roundCount++;
+        return STEP_ROUND_START;
+    }
+
+    int playerTurn = session -> playerTurn = session -> turns[session -> turnIndex];
+
+    // Send to all the player the current info
+    if ((playerTurn != 0) && !sendMessage(session -> room, playerTurn, OP_YOUR_TURN, NULL, 0)) {
+        printf("\nError while sending the turn info!");
+    }
+
+    if (!broadcastMessage(session -> room, OP_NOT_YOUR_TURN, NULL, 0, playerTurn)) {
+        printf("\nError while sending the turn info!");
+    }
+
+    // Check the status of the game, starting from the first player
+    session -> eliminatedIndex = 0;
+
+    return STEP_CHECK_STATUS;
+}
+
+static TurnStep checkGameStatus(GameSession* session, char* input) {
+    // If all the three different type of evidence has been collected, then the players win
+    if ((session -> caravanEvidence[0] != NO_EVIDENCE) && (session -> caravanEvidence[1] != NO_EVIDENCE) && (session -> caravanEvidence[2] != NO_EVIDENCE)) {
+        session -> gameState = WIN;
+        return STEP_GAME_END;
+    }
+
+    // Eliminate one player at a time, so that each one can confirm to have read it
+    for (int i = session -> eliminatedIndex; i < session -> playerCount; i++) {
+        // If the mental health of the player is equal or less than 0, then eliminate the player
+        if ((session -> players[i] != NULL) && ((session -> players[i] -> mentalHealth) <= 0)) {
+            free(session -> players[i]);
+            session -> players[i] = NULL;
+
+            if (i == 0) {
+                printColored("\nYou have been eliminated because your mental health is less than 0!", RED);
+            } else {
+                if (!sendCatalog(session -> room, i, MSG_ELIMINATED)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+
+            // Continue from the next player once confirmed
+            session -> eliminatedIndex = i + 1;
+            awaitConfirm(session, i, MSG_PRESS_ENTER);
+
+            return STEP_CHECK_STATUS;
+        }
+    }
+
+    // Count the players that have been eliminated
+    int playersEliminated = 0;
+    for (int i = session -> firstPlayer; i < session -> playerCount; i++) {
+        if (session -> players[i] == NULL) {
+            playersEliminated++;
+        }
+    }
+
+    // If every player has been eliminated, then game over
+    if (playersEliminated == (session -> playerCount - session -> firstPlayer)) {
+        session -> gameState = GAME_OVER;
+        return STEP_GAME_END;
+    }
+
+    // If the player has been eliminated skip his turn
+    if (session -> players[session -> playerTurn] == NULL) {
+        // Send the terminate turn signal
+        if (!broadcastMessage(session -> room, OP_TURN_TERMINATED, NULL, 0, ALL_CLIENTS)) {
+            printf("\nError while sending info");
+        }
+
+        session -> turnIndex++;
+        return STEP_TURN_START;
+    }
+
+    return STEP_ACTION;
+}
+
+static void showActionMenu(GameSession* session) {
+    int playerTurn = session -> playerTurn;
+    Player* player = session -> players[playerTurn];
+
+    // Send to all the player the current info
+    if (!broadcastCatalog(session -> room, MSG_TURN_BANNER, ALL_CLIENTS, (session -> roundCount + 1), (session -> turnIndex + 1), player -> playerName)) {
+        printf("\nError while sending the turn info!");
+    }
+
+    // Send to all the player the current info
+    if (!broadcastCatalog(session -> room, MSG_WAIT_TURN_END, playerTurn)) {
+        printf("\nError while sending the turn info!");
+    }
+
+    // The clients render the menu by themselves
+    if (playerTurn != 0) {
+        printTurnHeader(session, NULL);
+        printColored("\nWait the end of the current turn!", YELLOW);
+
+        if (player -> useAdvices) {
+            char* temp = printAdvices(session, playerTurn);
+            char spacer[] = "\n----------------------------------------------------------------------------------------------------\n";
+            char* advice = (char*) malloc(750);
+            int infoSize = sprintf(advice, "%s%s%s%s%s", spacer, colorsCodes[CYAN], temp, colorsCodes[DEFAULT_COLOR], spacer);
+            advice = (char*) realloc(advice, infoSize + 1);
+            if (!sendData(session -> room, playerTurn, advice)) {
+                printf("\nError while sending the advice!");
+            }
+            free(temp);
+            free(advice);
+        }
+
+        // Send the game state to the player, only the changes if it already has it
+        syncState(session, playerTurn, session -> turnIndex);
+
+        // Send the menu info
+        if (!sendCatalog(session -> room, playerTurn, MSG_ACTION_MENU)) {
+            printf("\nError while sending the advice!");
+        }
+
+        return;
+    }
+
+    printTurnHeader(session, NULL);
+
+    if (player -> useAdvices) {
+        printf("\n----------------------------------------------------------------------------------------------------\n");
+        char* advice = printAdvices(session, 0);
+        printf("%s%s%s", colorsCodes[CYAN], advice, colorsCodes[DEFAULT_COLOR]);
+        printf("\n----------------------------------------------------------------------------------------------------\n");
+        free(advice);
+    }
+
+    printf("\n1) Go to the caravan to deposit all the evidence from the backpack;");
+    printf("\n2) Go to the next zone;");
+    printf("\n3) Pick the evidence from the current zone;");
+    printf("\n4) Pick the object from the current zone;");
+    printf("\n5) Use an object from the backpack;");
+    printf("\n6) Skip the turn;");
+    printf("\n7) Give an object to another player in the same room;");
+    printf("\n8) Remove an object;");
+    printf("\n9) Reorganize the backpack;");
+    printf("\n10) Print the player info;");
+    printf("\n11) Print the current zone info;");
+    printf("\n12) Print all the evidence in the caravan;");
+    printf("\n13) Print the ghost info;");
+    printf("\n14) Print the game info;");
+    printf("\n15) Exit the game.");
+    printf("\nChoose an action from the option above: ");
+
+    return;
+}
+
+static TurnStep chooseAction(GameSession* session, char* input) {
+    int playerTurn = session -> playerTurn;
+    int index = session -> turnIndex;
+
+    if (input == NULL) {
+        showActionMenu(session);
+        awaitInput(session, playerTurn);
+        return STEP_ACTION;
+    }
+
+    switch (atoi(input)) {
+        case 1:
+            // If there's a ghost the player can't go to the caravan
+            if (session -> ghostPosition == (session -> players[playerTurn] -> position -> zone)) {
+                if (playerTurn == 0) {
+                    printColored("\nYou can't go to the caravan, because there's a ghost at your position!", YELLOW);
+                } else {
+                    char* info = (char*) malloc(105);
+                    int size = sprintf(info, "%s\nYou can't go to the caravan, because there's a ghost at your position!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
+                    info = (char*) realloc(info, size + 1);
+                    if (!sendData(session -> room, playerTurn, info)) {
+                        printf("\nError while sending info!");
+                    }
+                    free(info);
+                }
+                return endAction(session);
+            }
+
+            goToCaravan(session, playerTurn);
+            return STEP_TURN_END;
+
+        case 2:
+            goToNextZone(session, playerTurn);
+            return STEP_TURN_END;
+
+        case 3:
+            pickEvidence(session, playerTurn);
+            return endAction(session);
+
+        case 4:
+            pickObject(session, playerTurn);
+            return endAction(session);
+
+        case 5:
+            return STEP_USE;
+
+        case 6:
+            if (playerTurn == 0) {
+                printColored("\nYou have skipped your turn!", YELLOW);
+            } else {
+                char* info = (char*) malloc(325);
+                int size = sprintf(info, "%s\nYou have skipped your turn!%s", colorsCodes[YELLOW], colorsCodes[DEFAULT_COLOR]);
+                info = (char*) realloc(info, size + 1);
+
+                if (!sendData(session -> room, playerTurn, info)) {
+                    printf("\nError while sending the info!");
+                }
+
+                free(info);
+            }
+            return STEP_TURN_END;
+
+        case 7:
+            return STEP_GIVE;
+
+        case 8:
+            return STEP_REMOVE;
+
+        case 9:
+            return STEP_REORGANIZE;
+
+        case 10:
+            printPlayer(session, playerTurn, index);
+            return endAction(session);
+
+        case 11:
+            printZone(session, playerTurn, index);
+            return endAction(session);
+
+        case 12:
+            printEvidenceCollected(session, playerTurn, index);
+            return endAction(session);
+
+        case 13:
+            printGhostInfo(session, playerTurn, index);
+            return endAction(session);
+
+        case 14:
+            {
+                // Show the current settings
+                char* gameSettings = showGameSettings(session);
+
+                if (playerTurn == 0) {
+                    // Regex to clear the terminal.
+                    printf("\e[1;1H\e[2J");
+
+                    printf("\n%sROUND: %d - TURN: %d\n%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (index + 1), colorsCodes[DEFAULT_COLOR]);
+                    printf("%s", gameSettings);
+                } else {
+                    char* info = (char*) malloc(1000);
+                    int size = sprintf(info, "\e[1;1H\e[2J\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (index + 1), session -> players[playerTurn] -> playerName, colorsCodes[DEFAULT_COLOR], gameSettings);
+                    info = (char*) realloc(info, size + 1);
+
+                    if (!sendData(session -> room, playerTurn, info)) {
+                        printf("\nError while sending the info!");
+                    }
+
+                    free(info);
+                }
+
+                free(gameSettings);
+            }
+            return endAction(session);
+
+        case 15:
+            closeGame(session);
+            return STEP_ENDED;
+
+        default:
+            if (playerTurn == 0) {
+                printColored("\nError: please insert a valid input!", RED);
+            } else {
+                char* info = (char*) malloc(125);
+                int size = sprintf(info, "%s\nError: please insert a valid input!%s", colorsCodes[RED], colorsCodes[DEFAULT_COLOR]);
+                info = (char*) realloc(info, size + 1);
+
+                if (!sendData(session -> room, playerTurn, info)) {
+                    printf("\nError while sending the info!");
+                }
+
+                free(info);
+            }
+            return endAction(session);
+    }
+}
+
+static TurnStep endTurn(GameSession* session, char* input) {
+    int playerTurn = session -> playerTurn;
+
+    // Send to the player what the action has changed
+    if (playerTurn != 0) {
+        syncState(session, playerTurn, session -> turnIndex);
+    }
+
+    // The probability that the mental health decrease is 20 %
+    int randomNum = randomNumber(session, 100);
+
+    if (randomNum < 20) {
+        session -> players[playerTurn] -> mentalHealth -= 15;
+
+        if (playerTurn) {
+            char* info = (char*) malloc(125);
+            int size = sprintf(info, "%s\n\nYour mental health has decreased to %d%s", colorsCodes[YELLOW], session -> players[playerTurn] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
+            info = (char*) realloc(info, size + 1);
+
+            if (!sendData(session -> room, playerTurn, info)) {
+                printf("\nError while sending the info!");
+            }
+
+            free(info);
+        } else {
+            printf("%s\n\nYour mental health has decreased to %d%s", colorsCodes[YELLOW], session -> players[playerTurn] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
+        }
+    }
+
+    // Before going to the next turn wait that the player confirms that has read that
+    awaitConfirm(session, playerTurn, MSG_PRESS_ENTER);
+
+    return STEP_TURN_CLOSE;
+}
+
+static TurnStep closeTurn(GameSession* session, char* input) {
+    // Send the terminate turn signal
+    if (!broadcastMessage(session -> room, OP_TURN_TERMINATED, NULL, 0, ALL_CLIENTS)) {
+        printf("\nError while sending info");
+    }
+
+    session -> turnIndex++;
+
+    return STEP_TURN_START;
+}
+
+static TurnStep endGame(GameSession* session, char* input) {
+    bool won = session -> gameState == WIN;
+
+    // Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+
+    printf("\n%s%s the players have %s!%s", won ? colorsCodes[GREEN] : colorsCodes[RED], won ? "The game ends," : "Game Over, ", won ? "won, congratulations" : "lost", colorsCodes[DEFAULT_COLOR]);
+
+    // Send the info of the end of the game to the players
+    char* info = (char*) malloc(125);
+    int size = sprintf(info, "\e[1;1H\e[2J\n%s%s the players have %s!%s", won ? colorsCodes[GREEN] : colorsCodes[RED], won ? "The game ends," : "Game Over, ", won ? "won, congratulations" : "lost", colorsCodes[DEFAULT_COLOR]);
+    info = (char*) realloc(info, size + 1);
+    if (!broadcastData(session -> room, info, ALL_CLIENTS)) {
+        printf("\nError while sending the info!");
+    }
+    free(info);
+
+    // Send every user the signal that the game has ended
+    if (!broadcastMessage(session -> room, OP_TERMINATE_GAME, NULL, 0, ALL_CLIENTS)) {
+        printf("\nError while sending the info!");
+    }
+
+    // Let the game master read the result before closing, a dedicated server has no one to wait
+    if (session -> firstPlayer == 0) {
+        awaitConfirm(session, 0, MSG_PRESS_ENTER_SPACED);
+    }
+
+    return STEP_GAME_CLOSE;
+}
+
+static TurnStep closeSession(GameSession* session, char* input) {
+    // Deallocate all the memory from the heap for the next game
+    closeGame(session);
+
+    return STEP_ENDED;
+}
+
+static const turnStepHandler turnSteps[STEPS_COUNT] = {
+    [STEP_ROUND_START] = startRound,
+    [STEP_TURN_START] = startTurn,
+    [STEP_CHECK_STATUS] = checkGameStatus,
+    [STEP_ACTION] = chooseAction,
+    [STEP_USE] = useObject,
+    [STEP_BUY] = buyObject,
+    [STEP_GIVE] = giveObjects,
+    [STEP_GIVE_TO] = giveObjectTo,
+    [STEP_REMOVE] = removeObject,
+    [STEP_REORGANIZE] = reorginizeBackpack,
+    [STEP_SWAP_WITH] = swapSlots,
+    [STEP_TURN_END] = endTurn,
+    [STEP_TURN_CLOSE] = closeTurn,
+    [STEP_GAME_END] = endGame,
+    [STEP_GAME_CLOSE] = closeSession,
+};
+
+static void advanceGame(GameSession* session, char* input) {
+    // A confirmation only needs to arrive, its content doesn't matter
+    if (session -> confirming) {
+        session -> confirming = FALSE;
+        input = NULL;
+    }
+
+    // Run the steps till one of them has to wait for a player
+    do {
+        session -> awaitingPlayer = NO_PLAYER;
+        session -> step = turnSteps[session -> step](session, input);
+        input = NULL;
+    } while ((session -> awaitingPlayer == NO_PLAYER) && (session -> step != STEP_ENDED));
+
+    // Send everything produced by the steps in a single write per player
+    flushAllData(session -> room);
+
+    // Wake up the game master, if it's his turn or the game has ended
+    pthread_cond_broadcast(&(session -> stepChanged));
+
+    return;
+}
+
+static bool receiveInput(void* context, int clientIndex, dataReceived message) {
+    GameSession* session = (GameSession*) context;
+
+    pthread_mutex_lock(&(session -> lock));
+
+    // Resume the session only with the input it's waiting for
+    if ((message.opcode == OP_INPUT) && (session -> step != STEP_ENDED) && (session -> awaitingPlayer == clientIndex)) {
+        advanceGame(session, message.data);
+    }
+
+    pthread_mutex_unlock(&(session -> lock));
+
+    releaseData(message.data);
+
+    return TRUE;
+}
+
+void playGame(GameSession* session) {
+    char hostInput[64];
+
+    pthread_mutex_init(&(session -> lock), NULL);
+    pthread_cond_init(&(session -> stepChanged), NULL);
+
+    session -> step = STEP_ROUND_START;
+    session -> confirming = FALSE;
+
+    // The inputs of the clients resume the session directly on the worker of the room
+    setInputHandler(session -> room, receiveInput, session);
+
+    pthread_mutex_lock(&(session -> lock));
+    advanceGame(session, NULL);
+
+    while (session -> step != STEP_ENDED) {
+        // Sleep while the clients are playing
+        if (session -> awaitingPlayer != 0) {
+            pthread_cond_wait(&(session -> stepChanged), &(session -> lock));
+            continue;
+        }
+
+        // Only the game master can resume the session now, so the lock isn't needed while he writes
+        pthread_mutex_unlock(&(session -> lock));
+        char* line = fgets(hostInput, sizeof(hostInput), stdin);
+        pthread_mutex_lock(&(session -> lock));
+
+        // The game master has closed the terminal
+        if (line == NULL) {
+            closeGame(session);
+            session -> step = STEP_ENDED;
+            break;
+        }
+
+        advanceGame(session, line);
+    }
+
+    pthread_mutex_unlock(&(session -> lock));
+
+    setInputHandler(session -> room, NULL, NULL);
+
+    pthread_cond_destroy(&(session -> stepChanged));
+    pthread_mutex_destroy(&(session -> lock));
+
+    return;
+}
+
+void closeGame(GameSession* session) {
+    // Deallocate all the players alive
+    free(session -> players);
+    session -> players = NULL;
+
+    // Recursively deallocate all the element from the list until the first zone is deallocated
+    while (session -> firstZone != NULL) {
+        deleteZone(session);
+    }
+    
+    // Deallocate the turns if already used
+    if (session -> turns != NULL) {
+        free(session -> turns);
+        session -> turns = NULL;
+    }
+
+    // Set the game status to unset
+    session -> gameState = UNSET;
+
+    return;
+}
+
+/* INTERNALS FUNCTIONS DEFINITION */
+
+static void insertZone(GameSession* session) {
+    // Allocate the space for a new zone
+    MapZone* newZone = (MapZone*) malloc(sizeof(MapZone));
+
+    // Initialize the linked list if isn't already initialized
+    if (session -> firstZone == NULL) {
+        // Set the first zone as the new zone created
+        session -> firstZone = newZone;
+        
+        // Set the last zone equal to the first zone to make the list circular
+        session -> lastZone = session -> firstZone;
+        
+        // Set the last zone as the next zone
+        session -> firstZone -> nextZone = session -> lastZone;
+
+        // Generate the type of zone (excluding the CARAVAN type)
+        session -> firstZone -> zone = randomNumber(session, 6) + 1;
+
+        // Generate the object inside the zone
+        int randomObject = randomNumber(session, 6) + 6;
+    
+        // If the generated object is equal to 11, assign it as NO_OBJECT (= 10)
+        session -> firstZone -> zoneObject = randomObject == 11 ? randomObject - 1 : randomObject;
+        
+        // Set the evidence in the zone as empty
+        session -> firstZone -> evidence = 0;
+
+        return;
+    }
+    
+    // The old last zone point to the new last zone
+    session -> lastZone -> nextZone = newZone;
+
+    // Set the last zone as the new zone created
+    session -> lastZone = newZone;
+
+    // Set the first zone as the next zone
+    session -> lastZone -> nextZone = session -> firstZone;
+
+    // Generate the type of zone (excluding the CARAVAN type)
+    session -> lastZone -> zone = randomNumber(session, 6) + 1;
+
+    // Generate the object inside the zone
+    int randomObject = randomNumber(session, 6) + 6;
+    
+    // If the generated object is equal to 11, assign it as NO_OBJECT (= 10)
+    session -> lastZone -> zoneObject = randomObject == 11 ? randomObject - 1 : randomObject;
+
+    // Set the evidence in the zone as empty
+    session -> lastZone -> evidence = 0;
+
+    return;
+}
+
+static void deleteZone(GameSession* session) {
+    // If the first zone is NULL, than the list is empty
+    if (session -> firstZone == NULL) {
+        return;
+    }
+    
+    // If the list has only one element reset the list
+    if (session -> firstZone == session -> lastZone) {
+        free(session -> firstZone);
+        session -> firstZone = NULL;
+        session -> lastZone = NULL;
+        return;
+    }
+
+    // Search for the zone that points to the last zone
+    MapZone* scan;
+    for (scan = session -> firstZone; (scan -> nextZone) != session -> lastZone; scan = (scan -> nextZone));
+    
+    // Deallocate the last zone
+    free(session -> lastZone);
+
+    // Set the element before the last zone as the new last zone
+    session -> lastZone = scan;
+
+    // Set the first zone as the next zone
+    session -> lastZone -> nextZone = session -> firstZone;
+
+    return;
+}
+
+static void printZones(GameSession* session) {
+    // If the first zone is NULL, than the list is empty
+    if (session -> firstZone == NULL) {
+        tellMaster(session, "\nThe map is empty!", YELLOW);
+        return;
+    }
+
+    char* map = printMap(session);
+
+    tellMaster(session, "\n------------- CURRENT MAP -------------\n", CYAN);
+    tellMaster(session, map, DEFAULT_COLOR);
+
+    free(map);
+
+    return;
+}
+
+static char* printMap(GameSession* session) {
+    // Count the zones, to allocate the space for all their names
+    int zonesCount = 0;
+    if (session -> firstZone != NULL) {
+        zonesCount++;
+        for (MapZone* scan = session -> firstZone; scan != session -> lastZone; scan = (scan -> nextZone)) {
+            zonesCount++;
+        }
+    }
+
+    char* result = (char*) malloc(20 + zonesCount * 20);
+    int currentLen = sprintf(result, "\nFirst Zone: ");
+
+    for (MapZone* scan = session -> firstZone; scan != session -> lastZone; scan = (scan -> nextZone)) {
+        currentLen += sprintf(result + currentLen, "%s --> ", zoneTypeNames[scan -> zone]);
+    }
+    
+    // Check if last zone is already defined
+    if (session -> lastZone != NULL) {
+        currentLen += sprintf(result + currentLen, "%s", zoneTypeNames[session -> lastZone -> zone]);
+    }
+
+    return result;
+}
+
+static void tellMaster(GameSession* session, char* text, ColorType color) {
+    // The game master is the first player, in the terminal of the server or on the first client of a dedicated server
+    if (session -> firstPlayer == 0) {
+        printColored(text, color);
+        return;
+    }
+
+    char* message = (char*) malloc(strlen(text) + 20);
+    sprintf(message, "%s%s%s", colorsCodes[color], text, colorsCodes[DEFAULT_COLOR]);
+
+    if (!sendData(session -> room, session -> firstPlayer, message)) {
+        printf("\nError while sending the info!");
+    }
+
+    free(message);
+
+    return;
+}
+
+static bool askMaster(GameSession* session, char* answer, int size) {
+    if (session -> firstPlayer == 0) {
+        // The game master has closed the terminal
+        if (fgets(answer, size, stdin) == NULL) {
+            return FALSE;
+        }
+
+        // If the line doesn't fit in the answer, then clean the stdin
+        if (strchr(answer, '\n') == NULL) {
+            int c;
+            while ((c = getc(stdin)) != EOF) {
+                if (c == '\n') {
+                    break;
+                }
+            }
+        }
+
+        return TRUE;
+    }
+
+    // Ask the client of the game master to send a line
+    if (!sendMessage(session -> room, session -> firstPlayer, OP_USER_INPUT, NULL, 0)) {
+        printf("\nError while sending the input request!");
+        return FALSE;
+    }
+    flushData(session -> room, session -> firstPlayer);
+
+    // Await the input, ignoring anything else
+    dataReceived input;
+    while ((input = getDataReceived(session -> room, session -> firstPlayer, NO_TIMEOUT)).opcode != OP_INPUT) {
+        // The game master has left
+        if (input.data == NULL) {
+            return FALSE;
+        }
+
+        releaseData(input.data);
+    }
+
+    snprintf(answer, size, "%s", input.data);
+    releaseData(input.data);
+
+    return TRUE;
+}
+
+static bool confirmMaster(GameSession* session) {
+    char answer[64];
+
+    tellMaster(session, "\n\nPress ENTER to continue: ", YELLOW);
+
+    return askMaster(session, answer, sizeof(answer));
+}
+
+static bool rejectSetting(GameSession* session) {
+    tellMaster(session, "\nError: please insert a valid input!", RED);
+
+    return confirmMaster(session);
+}
+
+static void goToCaravan(GameSession* session, int playerIndex) {
+    // Move all the evidence in the backpack to the caravan
+    int hasEvidences = 0;
+
+    for (int i = 0; i < 4; i++) {
+        unsigned char backpackSlot = session -> players[playerIndex] -> backpack[i];
+        
+        // Check if the current slot is empty or if is not of type EvidenceType
+        if ((backpackSlot == EMPTY_SLOT) || (backpackSlot < 11)) {
+            continue;
+        } else {
+            hasEvidences = 1;
+            // Add the evidence to a slot determined by the type of evidence, to prevent duplicate
+            session -> caravanEvidence[backpackSlot - 11] = backpackSlot;
+
+            // Set the backpack slot to empty
+            session -> players[playerIndex] -> backpack[i] = EMPTY_SLOT;
+
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nEvidence (%s) has been left in the caravan!%s", colorsCodes[MAGENTA], objectsNames[backpackSlot], colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_EVIDENCE_LEFT, objectsNames[backpackSlot])) {
+                    printf("\nError while sending the info!");
+                }
+            }
+        }
+    }
+
+    // Check if the player has evidences
+    if (!hasEvidences) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printColored("\nYou don't have evidences!", YELLOW);      
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_NO_EVIDENCES)) {
+                printf("\nError while sending the info!");
+            }
+        }
+    }
+
+    // Set the player position to the first zone
+    session -> players[playerIndex] -> position = session -> firstZone;
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printColored("\nYou have been repositioned in the first zone!", MAGENTA);     
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_REPOSITIONED_FIRST_ZONE)) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    return;
+}
+
+static void printPlayer(GameSession* session, int playerIndex, int currentTurn) {
+    Player* player = session -> players[playerIndex];
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        // Regex to clear the terminal.
+        printf("\e[1;1H\e[2J");
+        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (currentTurn + 1), session -> players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
+        printColored("\n------------- PLAYER INFO -------------\n", MAGENTA);
+        printf("\nName: %s", player -> playerName);
+        printf("\nMental Health: %d", player -> mentalHealth);
+        printf("\nPosition: %s", zoneTypeNames[player -> position -> zone]);
+        printf((session -> players[playerIndex] -> useAdvices) ? "\nThe advices are active" : "\nThe advices are inactive");
+        printf((session -> players[playerIndex] -> saltProtection) ? "\nThe salt protection is active" : "\nThe salt protection is inactive");
+
+    } else {
+        // The player renders the screen by itself
+        showScreen(session, playerIndex, currentTurn, SCREEN_PLAYER_INFO);
+        return;
+    }
+    
+    // Print the backpack's slots
+    for (int i = 0; i < 4; i++) {
+        int slot = player -> backpack[i];
+        printf("\nSlot %d: %s", (i + 1), objectsNames[slot]);
+    }
+
+    return;
+}
+
+static void printZone(GameSession* session, int playerIndex, int currentTurn) {
+    MapZone* currentZone = session -> players[playerIndex] -> position;
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+    // Regex to clear the terminal.
+    printf("\e[1;1H\e[2J");
+    printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (currentTurn + 1), session -> players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
+    printColored("\n------------- ZONE INFO -------------\n", MAGENTA);
+    printf("\nCurrent zone: %s", zoneTypeNames[currentZone -> zone]);
+    printf("\nEvidence in the current zone: %s", objectsNames[currentZone -> evidence]);
+    printf("\nObject in the current zone: %s", objectsNames[currentZone -> zoneObject]);
+    printf("\nNext zone: %s", zoneTypeNames[currentZone -> nextZone -> zone]);
+
+    } else {
+        // The player renders the screen by itself
+        showScreen(session, playerIndex, currentTurn, SCREEN_ZONE_INFO);
+    }
+
+    return;
+}
+
+static void goToNextZone(GameSession* session, int playerIndex) {
+    // Generate the object for the current zone if there aren't
+    if ((session -> players[playerIndex] -> position -> zoneObject) == NO_OBJECT) {
+        int randomObject = randomNumber(session, 10) + 1;
+        session -> players[playerIndex] -> position -> zoneObject = randomObject;
+        
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printf("%s\nThe object in the %s has been added!%s", colorsCodes[MAGENTA], zoneTypeNames[session -> players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_OBJECT_ADDED, zoneTypeNames[session -> players[playerIndex] -> position -> zone])) {
+                printf("\nError while sending the info!");
+            }
+        }
+    }
+
+    // Move the player position to the next zone
+    session -> players[playerIndex] -> position = session -> players[playerIndex] -> position -> nextZone;
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printf("%s\nYou have been repositioned in the %s!%s", colorsCodes[MAGENTA], zoneTypeNames[session -> players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_REPOSITIONED, zoneTypeNames[session -> players[playerIndex] -> position -> zone])) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    // Change the evidence in the zone reached by the player
+    int randomEvidence = randomNumber(session, 5) + 11;
+    
+    // If the generated num is equal to 15, assign it as NO_EVIDENCE (= 14)
+    EvidenceType newEvidence = randomEvidence == 15 ? randomEvidence - 1 : randomEvidence;
+    session -> players[playerIndex] -> position -> evidence = newEvidence;
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printf("%s\nThe evidence in the %s has been changed!%s", colorsCodes[MAGENTA], zoneTypeNames[session -> players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_EVIDENCE_CHANGED, zoneTypeNames[session -> players[playerIndex] -> position -> zone])) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    // Generate the object for the zone reached if there aren't
+    if ((session -> players[playerIndex] -> position -> zoneObject) == NO_OBJECT) {
+        int randomObject = randomNumber(session, 10) + 1;
+        session -> players[playerIndex] -> position -> zoneObject = randomObject;
+        
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printf("%s\nThe object in the %s has been added!%s", colorsCodes[MAGENTA], zoneTypeNames[session -> players[playerIndex] -> position -> zone], colorsCodes[DEFAULT_COLOR]);
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_OBJECT_ADDED, zoneTypeNames[session -> players[playerIndex] -> position -> zone])) {
+                printf("\nError while sending the info!");
+            }
+        }
+    }
+
+    return;
+}
+
+static void pickEvidence(GameSession* session, int playerIndex) {
+    unsigned char currentZoneEvidence = session -> players[playerIndex] -> position -> evidence;
+
+    if (currentZoneEvidence == NO_EVIDENCE) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printColored("\nThere's no object in this zone that can be picked!", YELLOW);
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_NO_PICKABLE_OBJECT)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        return;
+    }
+
+    // Check if there's the object to pick the evidence, decrement the evidence by 10 to get the object needed to pick it
+    // And if there's change the object with the evidence
+    for (int i = 0; i < 4; i++) {
+        if ((session -> players[playerIndex] -> backpack[i]) == (currentZoneEvidence - 10)) {
+            session -> players[playerIndex] -> backpack[i] = currentZoneEvidence;
+            
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nEvidence %s has been picked!%s", colorsCodes[MAGENTA], objectsNames[session -> players[playerIndex] -> backpack[i]], colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_EVIDENCE_PICKED, objectsNames[session -> players[playerIndex] -> backpack[i]])) {
+                    printf("\nError while sending the info!");
+                }
+            }
+
+            // Generate a random number to check the possibility that the ghost appears
+            int randomNum = randomNumber(session, 100);
+            if (randomNum < session -> ghostAppearance) {
+                // Spawn the ghost in the same zone as the current player
+                session -> ghostPosition = session -> players[playerIndex] -> position -> zone;
+                
+                // Send the info if is not the game master
+                if (playerIndex == 0) {
+                    printf("%s\nThe ghost spawn in the %s zone!%s", colorsCodes[MAGENTA], zoneTypeNames[session -> ghostPosition], colorsCodes[DEFAULT_COLOR]);
+                } else {
+                    if (!sendCatalog(session -> room, playerIndex, MSG_GHOST_SPAWNED, zoneTypeNames[session -> ghostPosition])) {
+                        printf("\nError while sending the info!");
+                    }
+                }
+
+                // Check if there's a player in the same position as the ghost, and if so decrement his mental health
+                for (int index = 0; index < session -> playerCount; index++) {
+                    // Check if the player has been eliminated
+                    if (session -> players[index] == NULL) {
+                        continue;
+                    }
+
+                    // If the player has used the SALT before, then his mental health won't decrement
+                    if (((session -> players[index] -> position -> zone) == session -> ghostPosition) && (!(session -> players[playerIndex] -> saltProtection))) {
+                        switch (session -> gameLevel) {
+                            case AMATEUR:
+                                session -> players[index] -> mentalHealth -= DECREMENT_AMATEUR;
+                                break;
+
+                            case INTERMEDIATE:
+                                session -> players[index] -> mentalHealth -= DECREMENT_INTERMEDIATE;
+                                break;
+
+                            case NIGHTMARE:
+                                session -> players[index] -> mentalHealth -= DECREMENT_NIGHTMARE;
+                                break;
+                        }
+                        
+
+                        // Send the info if is not the game master
+                        if (playerIndex == 0) {
+                            printf("%s\nThe ghost is in the same room as %s, so %s's mental health decrease to %d!%s", colorsCodes[MAGENTA], session -> players[index] -> playerName, session -> players[index] -> playerName, session -> players[index] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
+                        } else {
+                            if (!sendCatalog(session -> room, playerIndex, MSG_GHOST_ATTACK, session -> players[index] -> playerName, session -> players[index] -> playerName, session -> players[index] -> mentalHealth)) {
+                                printf("\nError while sending the info!");
+                            }
+                        }
+                    
+                    }
+                }
+            }
+
+            // Increment the possibility that a ghost appears (based on the difficulty)
+            switch (session -> gameLevel) {
+                case AMATEUR:
+                    session -> ghostAppearance += INCREMENT_AMATEUR;
+                    break;  
+
+                case INTERMEDIATE:
+                    session -> ghostAppearance += INCREMENT_INTERMEDIATE;
+                    break;        
+                    
+                case NIGHTMARE:
+                    session -> ghostAppearance += INCREMENT_NIGHTMARE;
+                    break;
+            }
+
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nThe probabilities that the ghost appears have been increased to %d%% %s", colorsCodes[MAGENTA], session -> ghostAppearance, colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_GHOST_PROBABILITY_INCREASED, session -> ghostAppearance)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+
+            return;
+        }
+    }
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printColored("\nYou don't have the object to pick the evidence in this zone!", YELLOW);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_MISSING_EVIDENCE_OBJECT)) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    return;
+}
+
+static void pickObject(GameSession* session, int playerIndex) {
+    // Check if there's an object in the zone
+    if ((session -> players[playerIndex] -> position -> zoneObject) == NO_OBJECT) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printColored("\nThe current zone has no objects!", YELLOW);
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_NO_ZONE_OBJECTS)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        return;
+    }
+
+    // Check if there's an empty slot for the object
+    for (int i = 0; i < 4; i++) {
+        if (session -> players[playerIndex] -> backpack[i] == EMPTY_SLOT) {
+            // Set the object in the backpack
+            session -> players[playerIndex] -> backpack[i] = session -> players[playerIndex] -> position -> zoneObject;
+
+            // Set the object in this zone to none, as it has been picked
+            session -> players[playerIndex] -> position -> zoneObject = NO_OBJECT;
+            
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nYou have picked the %s!%s", colorsCodes[MAGENTA], objectsNames[session -> players[playerIndex] -> backpack[i]], colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_OBJECT_PICKED, objectsNames[session -> players[playerIndex] -> backpack[i]])) {
+                    printf("\nError while sending the info!");
+                }
+            }
+
+            return;
+        }
+    }
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printColored("\nThe backpack's slots are full, you can't pick the object!", YELLOW);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_BACKPACK_FULL)) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    return;
+}
+
+static TurnStep useObject(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+    unsigned char usableObjects[] = {0, 0, 0, 0};
+    int usableObjectsCount = 0;
+
+    // Collect the objects that can be used
+    for (int i = 0; i < 4; i++) {
+        unsigned char backpackObject = session -> players[playerIndex] -> backpack[i];
+        if ((3 < backpackObject) && (backpackObject < 10)) {
+            usableObjects[usableObjectsCount] = backpackObject;
+            usableObjectsCount++;
+        }
+    }
+
+    if (input == NULL) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- USABLE OBJECTS -------------\n");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_USABLE_OBJECTS_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        // Print as options only the objects that can be used
+        for (int i = 0; i < 4; i++) {
+            unsigned char backpackObject = session -> players[playerIndex] -> backpack[i];
+            if ((3 < backpackObject) && (backpackObject < 10)) {
+                // Send the info if is not the game master
+                if (playerIndex == 0) {
+                    printf("\n%d) Use the %s;", i + 1, objectsNames[backpackObject]);
+                } else {
+                    if (!sendCatalog(session -> room, playerIndex, MSG_USE_OPTION, i + 1, objectsNames[backpackObject])) {
+                        printf("\nError while sending the info!");
+                    }
+                }
+            }
+        }
+
+        // Check if there's object to be used in the backpack
+        if (usableObjectsCount == 0) {
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nThere aren't object that can be used!", YELLOW);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_NO_USABLE_OBJECTS)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+
+            return endAction(session);
+        }
+
+        // Print the commands only if is the game master
+        if (!playerIndex) {
+            // Add an option to list all the effects of the objects availables
+            printf("\n5) Print all the effects of the objects availables;");
+
+            // Add an option to exit the menu
+            printf("\n6) Exit the menu.");
+
+            printf("\nChoose from the option above: ");
+        } else {
+            // Ask to choose an option
+            if (!sendCatalog(session -> room, playerIndex, MSG_USE_MENU)) {
+                printf("\nError while sending the advice!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_USE;
+    }
+
+    int choice = atoi(input);
+
+    // Check if the given input is between 1 and 6
+    if ((1 > choice) || (choice > 6)) {
+        rejectInput(session, playerIndex);
+        return STEP_USE;
+    }
+
+    // Check if the player chose one of the extra optons
+    if (choice == 5) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- OBJECTS INFO -------------\n");
+            printf("%s", printObjectsInfo(usableObjects));
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_OBJECTS_INFO_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName, printObjectsInfo(usableObjects))) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        awaitConfirm(session, playerIndex, MSG_PRESS_ENTER_SPACED);
+        return STEP_USE;
+
+    } else if (choice == 6) {
+        return endAction(session);
+    }
+
+    switch (session -> players[playerIndex] -> backpack[choice - 1]) {
+        case 4:
+            // Use the SEDATIVE object to increase the mental health by 40
+            session -> players[playerIndex] -> mentalHealth += 40;
+            session -> players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nYou used the SEDATIVE, and your mental health has increased to %d!%s", colorsCodes[MAGENTA], session -> players[playerIndex] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_SEDATIVE_USED, session -> players[playerIndex] -> mentalHealth)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+
+        case 5:
+            // Use the SALT to prevent a decrement of the mental health, caused by the ghost
+            session -> players[playerIndex] -> saltProtection = 1;
+            session -> players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nYou used the SALT, the next appearence of the ghost won't affect your mental health!", MAGENTA);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_SALT_USED)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+
+        case 6:
+            // Use the ADRENALINE to go to the next zone and obtain an extra turn
+            session -> players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nYou used the ADRENALINE, and went to the next zone, obtaining an extra turn!", MAGENTA);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_ADRENALINE_USED)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            goToNextZone(session, playerIndex);
+            return endAction(session);
+
+        case 7:
+            // Use the HUNDRED_DOLLAR to buy a TRANQUILLIZER or SALT
+            session -> selectedSlot = choice - 1;
+            return STEP_BUY;
+
+        case 8:
+            // Use the KNIFE and if the mental health is under 30 kill all the players in the same zone as the current player
+            ZoneType currentZone = ((session -> players[playerIndex]) -> position) -> zone;
+            session -> players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
+
+            if ((session -> players[playerIndex] -> mentalHealth) < 30) {
+                for (int i = 0; i < session -> playerCount; i++) {
+                    // Check if the player has been eliminated
+                    if (session -> players[i] == NULL) {
+                        continue;
+                    }
+
+                    if ((i != playerIndex) && ((session -> players[i] -> position -> zone) == currentZone)) {
+                        // Send the info if is not the game master
+                        if (playerIndex == 0) {
+                            printf("%s\nYou used the KNIFE, and killed %s!%s", colorsCodes[MAGENTA], session -> players[i] -> playerName, colorsCodes[DEFAULT_COLOR]);
+                        } else {
+                            if (!sendCatalog(session -> room, playerIndex, MSG_KNIFE_KILLED, session -> players[i] -> playerName)) {
+                                printf("\nError while sending the info!");
+                            }
+                        }
+
+                        free(session -> players[i]);
+                        session -> players[i] = NULL;
+                    }
+                }
+
+            } else {
+                // Send the info if is not the game master
+                if (playerIndex == 0) {
+                    printColored("\nYou used the KNIFE, but you didn't hurt anybody!", MAGENTA);
+                } else {
+                    if (!sendCatalog(session -> room, playerIndex, MSG_KNIFE_MISSED)) {
+                        printf("\nError while sending the info!");
+                    }
+                }
+            }
+            return endAction(session);
+
+        case 9:
+            // Use the TRANQUILLIZER object to increase the mental health by 40
+            session -> players[playerIndex] -> mentalHealth += 40;
+            session -> players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nYou used the TRANQUILLIZER, and your mental health has increased to %d!%s",  colorsCodes[MAGENTA], session -> players[playerIndex] -> mentalHealth, colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_TRANQUILLIZER_USED, session -> players[playerIndex] -> mentalHealth)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+
+        default:
+            rejectInput(session, playerIndex);
+            return STEP_USE;
+    }
+}
+
+static TurnStep buyObject(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+
+    if (input == NULL) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printf("\nChoose what you want to buy between: ");
+            printf("\n1) TRANQUILLIZER;");
+            printf("\n2) SALT.");
+            printf("\nInsert an option: ");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_BUY_MENU)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_BUY;
+    }
+
+    switch (atoi(input)) {
+        case 1:
+            session -> players[playerIndex] -> backpack[session -> selectedSlot] = TRANQUILLIZER;
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nYou bought the TRANQUILLIZER!", MAGENTA);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_TRANQUILLIZER_BOUGHT)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+
+        case 2:
+            session -> players[playerIndex] -> backpack[session -> selectedSlot] = SALT;
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nYou bought the SALT!", MAGENTA);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_SALT_BOUGHT)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+
+        default:
+            // Send the info if is not the game master, then ask again
+            if (playerIndex == 0) {
+                printColored("\nError: please insert a valid input!", RED);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_INVALID_INPUT)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return STEP_BUY;
+    }
+}
+
+static TurnStep giveObjects(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+
+    if (input == NULL) {
+        // Check that there's more than one player
+        if ((session -> playerCount - session -> firstPlayer) == 1) {
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nYou can't trade with yourself!", YELLOW);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_SELF_TRADE)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+        }
+
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- GIVABLE OBJECTS -------------\n");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_GIVABLE_OBJECTS_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        // Show the objects that can be traded
+        for (int i = 0; i < 4; i++) {
+            if ((session -> players[playerIndex] -> backpack[i] != EMPTY_SLOT)) {
+                // Send the info if is not the game master
+                if (playerIndex == 0) {
+                    printf("\n%d) Give the %s", i + 1, objectsNames[session -> players[playerIndex] -> backpack[i]]);
+                } else {
+                    if (!sendCatalog(session -> room, playerIndex, MSG_GIVE_OPTION, i + 1, objectsNames[session -> players[playerIndex] -> backpack[i]])) {
+                        printf("\nError while sending the info!");
+                    }
+                }
+            }
+        }
+
+        if (!playerIndex) {
+            // Add an option to exit the menu
+            printf("\n5) Exit the menu.");
+            printf("\nChoose from the option above: ");
+        } else {
+            // Ask to confirm
+            if (!sendCatalog(session -> room, playerIndex, MSG_EXIT_MENU)) {
+                printf("\nError while sending the advice!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_GIVE;
+    }
+
+    int choice = atoi(input);
+
+    // Check if the input is valid
+    if ((1 > choice) || (choice > 5)) {
+        rejectInput(session, playerIndex);
+        return STEP_GIVE;
+    }
+
+    if (choice == 5) {
+        return endAction(session);
+    }
+
+    // Check that the selected object is valid
+    if (session -> players[playerIndex] -> backpack[choice - 1] == EMPTY_SLOT) {
+        rejectInput(session, playerIndex);
+        return STEP_GIVE;
+    }
+
+    session -> selectedSlot = choice - 1;
+
+    return STEP_GIVE_TO;
+}
+
+static TurnStep giveObjectTo(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+    unsigned char selectedObject = session -> players[playerIndex] -> backpack[session -> selectedSlot];
+    ZoneType currentZone = session -> players[playerIndex] -> position -> zone;
+
+    if (input == NULL) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- AVAILABLE PLAYERS -------------\n");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_AVAILABLE_PLAYERS_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        for (int i = 0; i < session -> playerCount; i++) {
+            // Check if the player has been eliminated
+            if (session -> players[i] == NULL) {
+                continue;
+            }
+
+            if ((i != playerIndex) && ((session -> players[i] -> position -> zone) == currentZone)) {
+                // Send the info if is not the game master
+                if (playerIndex == 0) {
+                    printf("\n%d) Give the %s to %s;", i + 1, objectsNames[selectedObject], session -> players[i] -> playerName);
+                } else {
+                    if (!sendCatalog(session -> room, playerIndex, MSG_GIVE_TO_OPTION, i + 1, objectsNames[selectedObject], session -> players[i] -> playerName)) {
+                        printf("\nError while sending the info!");
+                    }
+                }
+            }
+        }
+
+        if (!playerIndex) {
+            // Add an option to exit the menu
+            printf("\n5) Exit the menu.");
+            printf("\nChoose from the option above: ");
+        } else {
+            // Ask to confirm
+            if (!sendCatalog(session -> room, playerIndex, MSG_EXIT_MENU)) {
+                printf("\nError while sending the advice!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_GIVE_TO;
+    }
+
+    int option = atoi(input);
+
+    // Check if the input is valid
+    if ((1 > option) || (option > 5)) {
+        rejectInput(session, playerIndex);
+        return STEP_GIVE_TO;
+    }
+
+    // Go back to the objects
+    if (option == 5) {
+        return STEP_GIVE;
+    }
+
+    // Check that the selected player is in the same zone
+    int selectedPlayer = option - 1;
+    if ((selectedPlayer == playerIndex) || (selectedPlayer >= session -> playerCount) || (session -> players[selectedPlayer] == NULL) || ((session -> players[selectedPlayer] -> position -> zone) != currentZone)) {
+        rejectInput(session, playerIndex);
+        return STEP_GIVE_TO;
+    }
+
+    for (int index = 0; index < 4; index++) {
+        if ((session -> players[selectedPlayer] -> backpack[index]) == EMPTY_SLOT) {
+            session -> players[selectedPlayer] -> backpack[index] = selectedObject;
+            session -> players[playerIndex] -> backpack[session -> selectedSlot] = EMPTY_SLOT;
+
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("%s\nYou gave the %s to %s%s", colorsCodes[MAGENTA], objectsNames[selectedObject], session -> players[selectedPlayer] -> playerName, colorsCodes[DEFAULT_COLOR]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_OBJECT_GIVEN, objectsNames[selectedObject], session -> players[selectedPlayer] -> playerName)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+        }
+    }
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printColored("\nThe selected player hasn't empty slots!", YELLOW);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_RECEIVER_BACKPACK_FULL)) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    awaitConfirm(session, playerIndex, MSG_PRESS_ENTER);
+
+    return STEP_GIVE_TO;
+}
+
+static TurnStep removeObject(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+
+    if (input == NULL) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- REMOVABLE OBJECTS -------------\n");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_REMOVABLE_OBJECTS_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        // Show the objects that can be removed
+        for (int i = 0; i < 4; i++) {
+            if ((session -> players[playerIndex] -> backpack[i] != EMPTY_SLOT)) {
+                // Send the info if is not the game master
+                if (playerIndex == 0) {
+                    printf("\n%d) Remove the %s", i + 1, objectsNames[session -> players[playerIndex] -> backpack[i]]);
+                } else {
+                    if (!sendCatalog(session -> room, playerIndex, MSG_REMOVE_OPTION, i + 1, objectsNames[session -> players[playerIndex] -> backpack[i]])) {
+                        printf("\nError while sending the info!");
+                    }
+                }
+            }
+        }
+
+        if (!playerIndex) {
+            // Add an option to exit the menu
+            printf("\n5) Exit the menu.");
+            printf("\nChoose from the option above: ");
+        } else {
+            // Ask to confirm
+            if (!sendCatalog(session -> room, playerIndex, MSG_EXIT_MENU)) {
+                printf("\nError while sending the advice!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_REMOVE;
+    }
+
+    int choice = atoi(input);
+
+    // Check if the input is valid
+    if ((1 > choice) || (choice > 5)) {
+        rejectInput(session, playerIndex);
+        return STEP_REMOVE;
+    }
+
+    if (choice == 5) {
+        return endAction(session);
+    }
+
+    unsigned char selectedObject = session -> players[playerIndex] -> backpack[choice - 1];
+
+    // Check that the selected object is valid
+    if (selectedObject == EMPTY_SLOT) {
+        rejectInput(session, playerIndex);
+        return STEP_REMOVE;
+    }
+
+    // Remove the object
+    session -> players[playerIndex] -> backpack[choice - 1] = EMPTY_SLOT;
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printf("%s\nYou have removed the %s from the backpack!%s", colorsCodes[MAGENTA], objectsNames[selectedObject], colorsCodes[DEFAULT_COLOR]);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_OBJECT_REMOVED, objectsNames[selectedObject])) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    return endAction(session);
+}
+
+static TurnStep reorginizeBackpack(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+
+    if (input == NULL) {
+        int emptySlots = 0;
+
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- BACKPACK SLOTS -------------\n");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_BACKPACK_SLOTS_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        for (int i = 0; i < 4; i++) {
+            unsigned char slot = session -> players[playerIndex] -> backpack[i];
+
+            // Count the number of empty slots
+            if (slot == EMPTY_SLOT) {
+                emptySlots++;
+            }
+
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("\n%d) %s;", i + 1, objectsNames[slot]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_SLOT_OPTION, i + 1, objectsNames[slot])) {
+                    printf("\nError while sending the info!");
+                }
+            }
+        }
+
+        // Check that at least one slot is used
+        if (emptySlots == 4) {
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printColored("\nAll the slots are empty, there's nothing to reorginize!", YELLOW);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_NOTHING_TO_REORGANIZE)) {
+                    printf("\nError while sending the info!");
+                }
+            }
+            return endAction(session);
+        }
+
+        if (!playerIndex) {
+            // Add an option to exit the menu
+            printf("\n5) Exit the menu.");
+            printf("\nInsert the number of the slot to swap: ");
+        } else {
+            // Ask to confirm
+            if (!sendCatalog(session -> room, playerIndex, MSG_SWAP_MENU)) {
+                printf("\nError while sending the advice!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_REORGANIZE;
+    }
+
+    int choice = atoi(input);
+
+    // Check for invalid input
+    if ((1 > choice) || (choice > 5)) {
+        rejectInput(session, playerIndex);
+        return STEP_REORGANIZE;
+    } else if (choice == 5) {
+        return endAction(session);
+    }
+
+    session -> selectedSlot = choice - 1;
+
+    return STEP_SWAP_WITH;
+}
+
+static TurnStep swapSlots(GameSession* session, char* input) {
+    int playerIndex = session -> playerTurn;
+    int choice = session -> selectedSlot + 1;
+    unsigned char slotToSwap = session -> players[playerIndex] -> backpack[session -> selectedSlot];
+
+    // Ask the player which slot to swap with the one selected before
+    if (input == NULL) {
+        // Send the info if is not the game master
+        if (playerIndex == 0) {
+            printTurnHeader(session, "\n------------- BACKPACK SLOTS -------------\n");
+        } else {
+            if (!sendCatalog(session -> room, playerIndex, MSG_BACKPACK_SLOTS_SCREEN, (session -> roundCount + 1), (session -> turnIndex + 1), session -> players[playerIndex] -> playerName)) {
+                printf("\nError while sending the info!");
+            }
+        }
+
+        // Show all the object in the backpack except the one selected before
+        for (int i = 0; i < 4; i++) {
+            if (i == (choice - 1)) {
+                continue;
+            }
+
+            // Send the info if is not the game master
+            if (playerIndex == 0) {
+                printf("\n%d) %s;", i + 1, objectsNames[session -> players[playerIndex] -> backpack[i]]);
+            } else {
+                if (!sendCatalog(session -> room, playerIndex, MSG_SLOT_OPTION, i + 1, objectsNames[session -> players[playerIndex] -> backpack[i]])) {
+                    printf("\nError while sending the info!");
+                }
+            }
+        }
+
+        if (!playerIndex) {
+            // Add an option to exit the menu
+            printf("\n5) Exit the menu.");
+            printf("\nInsert the number of the slot to swap with the %s: ", objectsNames[slotToSwap]);
+        } else {
+            // Ask to confirm
+            if (!sendCatalog(session -> room, playerIndex, MSG_SWAP_WITH_MENU, objectsNames[slotToSwap])) {
+                printf("\nError while sending the advice!");
+            }
+        }
+
+        awaitInput(session, playerIndex);
+        return STEP_SWAP_WITH;
+    }
+
+    int option = atoi(input);
+
+    // Check for invalid input
+    if ((1 > option) || (option > 5) || (option == choice)) {
+        rejectInput(session, playerIndex);
+        return STEP_SWAP_WITH;
+    } else if (option == 5) {
+        return STEP_REORGANIZE;
+    }
+
+    // Swap the selected slots
+    unsigned char selectedSlot = session -> players[playerIndex] -> backpack[option - 1];
+    session -> players[playerIndex] -> backpack[choice - 1] = selectedSlot;
+    session -> players[playerIndex] -> backpack[option - 1] = slotToSwap;
+
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        printf("%s\nSwapped the %s with the %s!%s", colorsCodes[MAGENTA], objectsNames[slotToSwap], objectsNames[selectedSlot], colorsCodes[DEFAULT_COLOR]);
+    } else {
+        if (!sendCatalog(session -> room, playerIndex, MSG_SLOTS_SWAPPED, objectsNames[slotToSwap], objectsNames[selectedSlot])) {
+            printf("\nError while sending the info!");
+        }
+    }
+
+    return endAction(session);
+}
+
+static int randomNumber(GameSession* session, int range) {
+    // Check if the current time has been already initialized
+    if (session -> currentTime == 0) {
+        // Initialize the random number generator using the current time
+        srand((unsigned) time(&(session -> currentTime)));
+    }
+
+    // Generate some numbers to increase the randomness
+    for (int i = 0; i < 10; i++) {
+        rand();
+    }
+
+    // Generate a random number and set it into the given range
+    return (rand() % range);
+}
+
+static void generateTurns(GameSession* session) {
+    // Check if the turns array has been already used
+    if (session -> turns != NULL) {
+        free(session -> turns);
+        session -> turns = NULL;
+    }
+
+    // Without a game master in the terminal, the players start from the first client
+    int playersCount = session -> playerCount - session -> firstPlayer;
+
+    // Allocate the memory for the turns array
+    session -> turns = (int*) calloc(playersCount, sizeof(int));
+
+    // Generate the players' turns
+    for (int i = 0; i < playersCount; i++) {
+        // Generate a random number
+        int randomNum = session -> firstPlayer + randomNumber(session, playersCount);
+        
+        for (int l = 0; l < i; l++) {
+            // If the generated number is already in the array, regenerate a new one and check it
+            if (session -> turns[l] == randomNum) {
+                // Reset the counter of the for loop
+                l = -1;
+
+                // Generate a new random number
+                randomNum = session -> firstPlayer + randomNumber(session, playersCount);
+            }
+        }
+        
+        session -> turns[i] = randomNum;
+    }
+
+    return;
+}
+
+static char* printObjectsInfo(unsigned char objects[]) {
+    unsigned char duplicates[] = {0, 0, 0, 0};
+    int duplicateCount = 0;
+    int isDuplicated;
+    
+    for (int index = 0; index < 4; index++) {
+        // Skip the object if it's not valid
+        if ((4 > objects[index]) && (objects[index] > 9)) {
+            continue;
+        }
+
+        // Check for duplicates
+        isDuplicated = 0;
+        for (int i = 0; i < duplicateCount; i++) {
+            if (objects[index] == duplicates[i]) {
+                isDuplicated = 1;
+                break;
+            }
+        }
+
+        // If the current object is not a duplicate than print its effect
+        if (!isDuplicated) {
+            // Add the object to the duplicates
+            duplicates[duplicateCount] = objects[index];
+            duplicateCount++;
+
+            // Show the info of the object
+            switch (objects[index]) {
+                case 4:
+                    return "\n- Use the SEDATIVE to increase the mental health by 40 points";
+
+                case 5:
+                    return "\n- Use the SALT to prevent a decrement of the mental health, caused by the ghost";
+
+                case 6:
+                    return "\n- Use the ADRENALINE to go to the next zone and obtain an extra turn";
+
+                case 7:
+                    return "\n- Use the HUNDRED_DOLLAR to buy a TRANQUILLIZER or SALT";
+
+                case 8:
+                    return "\n- Use the KNIFE and if the mental health is under 30 kill all the players in the same zone as the current player";
+
+                case 9:
+                    return "\n- Use the TRANQUILLIZER to increase the mental health by 40 points";
+            }
+        }
+    }
+
+    return " ";
+}
+
+static void printEvidenceCollected(GameSession* session, int playerIndex, int currentTurn) {
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        // Regex to clear the terminal.
+        printf("\e[1;1H\e[2J");
+        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (currentTurn + 1), session -> players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
+        printColored("\n------------- EVIDENCE COLLECTED IN THE CARAVAN -------------\n", MAGENTA);
+
+    } else {
+        // The player renders the screen by itself
+        showScreen(session, playerIndex, currentTurn, SCREEN_CARAVAN_EVIDENCE);
+        return;
+    }
+
+
+    for (int i = 0; i < 3; i++) {
+        printf("\n%d) %s", i + 1, objectsNames[session -> caravanEvidence[i]]);
+    }
+    
+    return;
+}
+
+static void printGhostInfo(GameSession* session, int playerIndex, int currentTurn) {
+    // Send the info if is not the game master
+    if (playerIndex == 0) {
+        // Regex to clear the terminal.
+        printf("\e[1;1H\e[2J");
+        printf("\n%sROUND: %d - TURN: %d - CURRENTLY PLAYING: %s\n%s", colorsCodes[MAGENTA], (session -> roundCount + 1), (currentTurn + 1), session -> players[playerIndex] -> playerName, colorsCodes[DEFAULT_COLOR]);
+        printColored("\n------------- GHOST INFO -------------", MAGENTA);
+        printf("\nGhost position: %s", zoneTypeNames[session -> ghostPosition]);
+        printf("\nGhost appeareance probability: %d%%", session -> ghostAppearance);        
+
+    } else {
+        // The player renders the screen by itself
+        showScreen(session, playerIndex, currentTurn, SCREEN_GHOST_INFO);
+    }
+
+    return;
+}
+
+static void printColored(char* str, ColorType color) {
+    printf("%s%s%s", colorsCodes[color], str, colorsCodes[DEFAULT_COLOR]);
+    return;
+}
+
+static char* printAdvices(GameSession* session, int playerIndex) {
+    Player* player = session -> players[playerIndex];
+    char* temp = (char*) malloc(375);
+    int currentLen = 0;
+
+    // Check if the player have an evidence to deposit
+    for (int i = 0; i < 4; i++) {
+        unsigned char slot = player -> backpack[i];
+        if ((slot >= 11) && (slot != EMPTY_SLOT)) {
+            currentLen = sprintf(temp, "ADVICE: Deposit the evidence in the caravan! (Type 1)");
+            temp = (char*) realloc(temp, currentLen + 1);            
+            return temp;
+        }
+    }    
+    
+    // Check if there's an evidence to pick
+    for (int i = 0; i < 4; i++) {
+        unsigned char slot = (player -> backpack[i]) + 10;
+        unsigned char currentEvidence = (player -> position -> evidence);
+        if ((currentEvidence == slot) && (slot != NO_EVIDENCE)) {
+            currentLen = sprintf(temp, "ADVICE: Pick the evidence from the current zone! (Type 3)");
+            temp = (char*) realloc(temp, currentLen + 1);
+            return temp;
+        }
+    }    
+    
+    // Check if the player have an object to use
+    for (int i = 0; i < 4; i++) {
+        unsigned char slot = player -> backpack[i];
+        if ((3 < slot) && (slot < 10)) {
+            currentLen = sprintf(temp, "ADVICE: Use an object from the backpack! (Type 5)");
+            temp = (char*) realloc(temp, currentLen + 1);
+            return temp;
+        }
+    }    
+    
+    // Check if there's an object to pick
+    for (int i = 0; i < 4; i++) {
+        unsigned char currentZoneObject = player -> position -> zoneObject;
+        if ((0 < currentZoneObject) && (currentZoneObject < 10)) {
+            currentLen = sprintf(temp, "ADVICE: Pick the object from the current zone! (Type 4)");
+            temp = (char*) realloc(temp, currentLen + 1);
+            return temp;
+        }
+    }    
+    
+    // Before checking if is better skip the turn, check if there's more than one player
+    if ((session -> playerCount - session -> firstPlayer) > 1) {
+        // Check if there's a player in the same zone that has the object to pick the evidence from the current zone
+        for (int index = 0; index < session -> playerCount; index++) {
+            // Don't evaluate the current player and the players eliminated
+            if ((index == playerIndex) || (session -> players[index] == NULL)) {
+                continue;
+            }
+
+            ZoneType currentEvaluatedZone = player -> position -> zone;
+            if (currentEvaluatedZone != (session -> players[index] -> position -> zone)) {
+                continue;
+            }
+
+            unsigned char currentZoneEvidence = (player -> position -> evidence);
+
+            for (int i = 0; i < 4; i++) {
+                // Add 10 to the current player object to verify if the objects match the corresponding evidence
+                unsigned char playerSlot = (session -> players[index] -> backpack[i]) + 10;
+
+                if ((playerSlot == currentZoneEvidence) && (playerSlot != NO_EVIDENCE)) {
+                    currentLen = sprintf(temp, "ADVICE: Skip the turn, because %s has the object to pick the evidence from the current zone! (Type 6)", session -> players[index] -> playerName);
+                    temp = (char*) realloc(temp, currentLen + 1);
+                    return temp;
+                }
+            }
+        }
+    }
+
+    // If there's nothing to do, advise to go to the next zone
+    currentLen = sprintf(temp, "ADVICE: Go to the next zone! (Type 2)");
+    temp = (char*) realloc(temp, currentLen + 1);
+    return temp;
+
+}
+
+/* END OF DEFINITIONS */
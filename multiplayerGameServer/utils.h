@@ -1,69 +1,125 @@
-//NOTE: This file contains all the functions needed to perform utility functions.
-
-#pragma once
-
-#ifndef _UTILS_H
-#define _UTILS_H
-#endif
-
-#define TRUE 1
-#define FALSE 0
-#define EMPTY_SLOT 15
-
-typedef int bool;
-
-typedef enum GameStates {UNSET, SET, WIN, GAME_OVER} GameStates;
-typedef enum TurnStates {PLAYING, FINISHED} TurnStates;
-typedef enum ColorType {BLACK, RED, GREEN, YELLOW, BLUE, MAGENTA, CYAN, WHITE, DEFAULT_COLOR} ColorType;
-typedef enum PropertyState {INACTIVE, ACTIVE} PropertyState;
-
-typedef enum GameDifficulties {AMATEUR, INTERMEDIATE, NIGHTMARE, INCREMENT_AMATEUR = 2, INCREMENT_INTERMEDIATE = 5, INCREMENT_NIGHTMARE = 10, DECREMENT_AMATEUR = 15, DECREMENT_INTERMEDIATE = 20, DECREMENT_NIGHTMARE = 30} GameDifficulties;
-typedef enum ZoneType {CARAVAN, KITCHEN, LIVING_ROOM, ROOM, BATHROOM, GARAGE, BASEMENT, NO_ZONE} ZoneType;
-typedef enum EvidenceType {EMF_EVIDENCE = 11, SPIRIT_BOX_EVIDENCE, CAMERA_EVIDENCE, NO_EVIDENCE} EvidenceType;
-typedef enum StarterObjectType {EMF = 1, SPIRIT_BOX, CAMERA, SEDATIVE, SALT} StarterObjectType;
-typedef enum ZoneObjectType {ADRENALINE = 6, HUNDRED_DOLLAR, KNIFE, TRANQUILLIZER, NO_OBJECT} ZoneObjectType;
-
-typedef struct MapZone {
-    ZoneType zone;
-    EvidenceType evidence;
-    ZoneObjectType zoneObject;
-    struct MapZone* nextZone;
-} MapZone;
-
-typedef struct Player {
-    char* playerName;
-    unsigned char mentalHealth;
-    MapZone* position;
-    unsigned char backpack[4];
-    PropertyState useAdvices;
-    PropertyState saltProtection;
-} Player;
-
-typedef struct dataReceived {
-    char* data;
-    int length;
-    int clientId;
-    struct dataReceived* next;
-} dataReceived;
-
-/// @brief Set the game. 
-void set(int playerNum);
-
-/// @brief Set the player at the given index.
-/// @param playerIndex
-/// @param info 
-void setPlayers(int playerIndex, char* info);
-
-/// @brief Return the current settings.
-/// @param response 
-/// @return Return the game settings.
-char* showGameSettings();
-
-/// @brief Start the game.
-void playGame();
-
-/// @brief Reset the data.
-void resetData();
-
-/// @brief Close the game by deallocating all the memory from the heap.
-void close();
\ No newline at end of file
+//NOTE: This file contains all the functions needed to perform utility functions.
+
+#pragma once
+
+#ifndef _UTILS_H
+#define _UTILS_H
+#endif
+
+#define TRUE 1
+#define FALSE 0
+#define EMPTY_SLOT 15
+#define MAX_CLIENTS 3
+#define NO_PLAYER -1
+
+typedef int bool;
+
+#include <time.h>
+#include <pthread.h>
+
+#include "protocol.h"
+
+typedef enum GameStates {UNSET, SET, WIN, GAME_OVER} GameStates;
+typedef enum TurnStep {STEP_ROUND_START, STEP_TURN_START, STEP_CHECK_STATUS, STEP_ACTION, STEP_USE, STEP_BUY, STEP_GIVE, STEP_GIVE_TO, STEP_REMOVE, STEP_REORGANIZE, STEP_SWAP_WITH, STEP_TURN_END, STEP_TURN_CLOSE, STEP_GAME_END, STEP_GAME_CLOSE, STEP_ENDED, STEPS_COUNT} TurnStep;
+typedef enum ColorType {BLACK, RED, GREEN, YELLOW, BLUE, MAGENTA, CYAN, WHITE, DEFAULT_COLOR} ColorType;
+typedef enum PropertyState {INACTIVE, ACTIVE} PropertyState;
+
+typedef enum GameDifficulties {AMATEUR, INTERMEDIATE, NIGHTMARE, INCREMENT_AMATEUR = 2, INCREMENT_INTERMEDIATE = 5, INCREMENT_NIGHTMARE = 10, DECREMENT_AMATEUR = 15, DECREMENT_INTERMEDIATE = 20, DECREMENT_NIGHTMARE = 30} GameDifficulties;
+typedef enum ZoneType {CARAVAN, KITCHEN, LIVING_ROOM, ROOM, BATHROOM, GARAGE, BASEMENT, NO_ZONE} ZoneType;
+typedef enum EvidenceType {EMF_EVIDENCE = 11, SPIRIT_BOX_EVIDENCE, CAMERA_EVIDENCE, NO_EVIDENCE} EvidenceType;
+typedef enum StarterObjectType {EMF = 1, SPIRIT_BOX, CAMERA, SEDATIVE, SALT} StarterObjectType;
+typedef enum ZoneObjectType {ADRENALINE = 6, HUNDRED_DOLLAR, KNIFE, TRANQUILLIZER, NO_OBJECT} ZoneObjectType;
+
+typedef struct MapZone {
+    ZoneType zone;
+    EvidenceType evidence;
+    ZoneObjectType zoneObject;
+    struct MapZone* nextZone;
+} MapZone;
+
+typedef struct Player {
+    char* playerName;
+    unsigned char mentalHealth;
+    MapZone* position;
+    unsigned char backpack[4];
+    PropertyState useAdvices;
+    PropertyState saltProtection;
+} Player;
+
+typedef struct dataReceived {
+    char* data;
+    int length;
+    int clientId;
+    protocolOpcode opcode;
+    struct dataReceived* next;
+} dataReceived;
+
+typedef struct serverRoom serverRoom;
+
+typedef struct GameSession {
+    serverRoom* room;
+    GameStates gameState;
+    int gameLevel;
+    int playerCount;
+    int firstPlayer;
+    Player** players;
+    MapZone* firstZone;
+    MapZone* lastZone;
+    int* turns;
+    EvidenceType caravanEvidence[3];
+    unsigned short sentStates[MAX_CLIENTS][STATE_FIELDS_COUNT];
+    bool snapshotsSent[MAX_CLIENTS];
+    ZoneType ghostPosition;
+    int ghostAppearance;
+    time_t currentTime;
+    int roundCount;
+    TurnStep step;
+    int turnIndex;
+    int playerTurn;
+    int awaitingPlayer;
+    bool confirming;
+    int selectedSlot;
+    int eliminatedIndex;
+    pthread_mutex_t lock;
+    pthread_cond_t stepChanged;
+} GameSession;
+
+/// @brief Ask the game master of a dedicated server how many players will join the room.
+/// @param session 
+/// @return Return the number of players, or 0 if the game master has left.
+int choosePlayersCount(GameSession* session);
+
+/// @brief Set the game, asking the difficulty and the map to the game master.
+/// @param session 
+/// @param playerNum 
+/// @return Return FALSE if the game master has left.
+bool set(GameSession* session, int playerNum);
+
+/// @brief Set the player at the given index.
+/// @param session 
+/// @param playerIndex
+/// @param info 
+void setPlayers(GameSession* session, int playerIndex, char* info);
+
+/// @brief Return the current settings.
+/// @param session 
+/// @return Return the game settings.
+char* showGameSettings(GameSession* session);
+
+/// @brief Show the settings to the game master, and wait that he starts the game.
+/// @param session 
+/// @param settings The settings already sent to the other players.
+/// @return Return FALSE if the game master has left.
+bool confirmGameSettings(GameSession* session, char* settings);
+
+/// @brief Start the game, the turns of the clients are played by the worker of the room when their inputs arrive, while this thread plays the turns of the game master.
+/// @param session 
+void playGame(GameSession* session);
+
+/// @brief Reset the data.
+/// @param session 
+void resetData(GameSession* session);
+
+/// @brief Close the game by deallocating all the memory from the heap.
+/// @param session 
+void closeGame(GameSession* session);
\ No newline at end of file